@@ -91,8 +91,10 @@ void Abstract_progress_watcher::object_processing_ended(
           finished_process_data->get_process_task_object());
   if (processed_table_task != nullptr &&
       finished_process_data->had_chain_created()) {
-    m_progress.m_table_count++;
-    this->progress_changed();
+    if (this->is_table_completed(processed_table_task)) {
+      m_progress.m_table_count++;
+      this->progress_changed();
+    }
     return;
   }
 
@@ -106,6 +108,22 @@ void Abstract_progress_watcher::object_processing_ended(
   }
 }
 
+bool Abstract_progress_watcher::is_table_completed(
+    Table_rows_dump_task *finished_rows_task) {
+  if (finished_rows_task->get_chunk_count() <= 1) return true;
+
+  /*
+    Chunks of a table are processed by different threads and finish in any
+    order, so the table is completed when all of them have finished.
+  */
+  std::lock_guard<std::mutex> lock(m_table_chunks_mutex);
+  Table *table = finished_rows_task->get_related_table();
+  size_t &completed_chunks = m_completed_table_chunks[table];
+  if (++completed_chunks < finished_rows_task->get_chunk_count()) return false;
+  m_completed_table_chunks.erase(table);
+  return true;
+}
+
 void Abstract_progress_watcher::object_processing_started(
     Item_processing_data *) {}
 
@@ -28,6 +28,8 @@
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <map>
+#include <mutex>
 
 #include "client/dump/abstract_chain_element.h"
 #include "client/dump/i_progress_watcher.h"
@@ -37,6 +39,9 @@ namespace Mysql {
 namespace Tools {
 namespace Dump {
 
+class Table;
+class Table_rows_dump_task;
+
 /**
   Gathers information about progress of current dump progress and format
   messages on progress.Also it should expose API for receiving processed
@@ -102,6 +107,12 @@ class Abstract_progress_watcher : public virtual I_progress_watcher,
    */
   void progress_changed();
 
+  /**
+    Returns true if the finished rows task was the last one of its table
+    to finish.
+   */
+  bool is_table_completed(Table_rows_dump_task *finished_rows_task);
+
   static const int STAGES = 10;
   static const int REPORT_DELAY_MS = 1000;
 
@@ -109,6 +120,10 @@ class Abstract_progress_watcher : public virtual I_progress_watcher,
   std::atomic<int64_t> m_step_countdown;
   std::atomic<int64_t> m_stage_countdown;
   int64 m_last_step_countdown;
+
+  /** Number of finished rows tasks of tables dumped in chunks. */
+  std::map<Table *, size_t> m_completed_table_chunks;
+  std::mutex m_table_chunks_mutex;
 };
 
 }  // namespace Dump
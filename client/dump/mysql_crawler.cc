@@ -25,6 +25,7 @@
 #include "client/dump/mysql_crawler.h"
 
 #include <stdlib.h>
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <vector>
@@ -283,22 +284,33 @@ void Mysql_crawler::enumerate_tables(const Database &db) {
 
     Table_definition_dump_task *ddl_task =
         new Table_definition_dump_task(table);
-    Table_rows_dump_task *rows_task = new Table_rows_dump_task(table);
     Table_deferred_indexes_dump_task *indexes_task =
         new Table_deferred_indexes_dump_task(table);
 
+    vector<string> chunk_conditions =
+        this->get_table_chunk_conditions(runner, *table);
+    if (chunk_conditions.empty()) chunk_conditions.push_back("");
+
+    vector<Abstract_dump_task *> rows_tasks;
+    for (size_t i = 0; i < chunk_conditions.size(); ++i) {
+      Table_rows_dump_task *rows_task = new Table_rows_dump_task(
+          table, chunk_conditions[i], chunk_conditions.size());
+      rows_task->add_dependency(ddl_task);
+      indexes_task->add_dependency(rows_task);
+      rows_tasks.push_back(rows_task);
+    }
+
     ddl_task->add_dependency(m_current_database_start_dump_task);
-    rows_task->add_dependency(ddl_task);
-    indexes_task->add_dependency(rows_task);
     m_current_database_end_dump_task->add_dependency(indexes_task);
     m_tables_definition_ready_dump_task->add_dependency(ddl_task);
 
     this->process_dump_task(ddl_task);
-    this->process_dump_task(rows_task);
+    for (Abstract_dump_task *rows_task : rows_tasks)
+      this->process_dump_task(rows_task);
 
-    this->enumerate_table_triggers(*table, rows_task);
+    this->enumerate_table_triggers(*table, rows_tasks);
 
-    this->enumerate_column_statistics(*table, rows_task);
+    this->enumerate_column_statistics(*table, rows_tasks);
 
     this->process_dump_task(indexes_task);
   }
@@ -500,8 +512,100 @@ void Mysql_crawler::enumerate_users() {
   delete runner;
 }
 
-void Mysql_crawler::enumerate_table_triggers(const Table &table,
-                                             Abstract_dump_task *dependency) {
+vector<string> Mysql_crawler::get_table_chunk_conditions(
+    Mysql::Tools::Base::Mysql_query_runner *runner, const Table &table) {
+  /* Upper limit of chunks a single table is split into. */
+  static const uint64 MAX_TABLE_CHUNKS = 1024;
+
+  vector<string> conditions;
+  uint64 chunk_rows = m_mysqldump_tool_cmaker_options->m_table_chunk_rows;
+  if (chunk_rows == 0 || table.get_row_count() <= chunk_rows)
+    return conditions;
+
+  std::vector<const Mysql::Tools::Base::Mysql_query_runner::Row *> key_columns;
+  if (runner->run_query_store(
+          "SHOW INDEX FROM " + this->get_quoted_object_full_name(&table) +
+              " WHERE Key_name = 'PRIMARY'",
+          &key_columns))
+    return conditions;
+  string column_name;
+  if (key_columns.size() == 1)
+    column_name = (*key_columns[0])[4];  // "Column_name"
+  Mysql::Tools::Base::Mysql_query_runner::cleanup_result(&key_columns);
+  if (column_name.empty()) return conditions;
+
+  string column_type;
+  for (const Field &field : table.get_fields()) {
+    if (field.get_name() == column_name) column_type = field.get_type_string();
+  }
+  static const char *integer_types[] = {"tinyint", "smallint", "mediumint",
+                                        "int", "bigint"};
+  bool is_integer = false;
+  for (const char *integer_type : integer_types) {
+    string prefix = integer_type;
+    if (column_type.compare(0, prefix.size(), prefix) == 0 &&
+        (column_type.size() == prefix.size() ||
+         column_type[prefix.size()] == '(' ||
+         column_type[prefix.size()] == ' ')) {
+      is_integer = true;
+    }
+  }
+  if (!is_integer) return conditions;
+  bool is_unsigned = column_type.find("unsigned") != string::npos;
+
+  string quoted_column = this->quote_name(column_name);
+  std::vector<const Mysql::Tools::Base::Mysql_query_runner::Row *> range;
+  if (runner->run_query_store("SELECT MIN(" + quoted_column + "), MAX(" +
+                                  quoted_column + ") FROM " +
+                                  this->get_quoted_object_full_name(&table),
+                              &range))
+    return conditions;
+  bool has_range = range.size() == 1 && !range[0]->is_value_null(0) &&
+                   !range[0]->is_value_null(1);
+  string min_value = has_range ? (*range[0])[0] : "";
+  string max_value = has_range ? (*range[0])[1] : "";
+  Mysql::Tools::Base::Mysql_query_runner::cleanup_result(&range);
+  if (!has_range) return conditions;
+
+  /*
+    Compute boundaries in unsigned arithmetic, which wraps around correctly
+    for signed values too.
+  */
+  uint64 min =
+      is_unsigned
+          ? strtoull(min_value.c_str(), nullptr, 10)
+          : static_cast<uint64>(strtoll(min_value.c_str(), nullptr, 10));
+  uint64 max =
+      is_unsigned
+          ? strtoull(max_value.c_str(), nullptr, 10)
+          : static_cast<uint64>(strtoll(max_value.c_str(), nullptr, 10));
+  uint64 span = max - min;
+
+  uint64 chunks = std::min(table.get_row_count() / chunk_rows + 1,
+                           MAX_TABLE_CHUNKS);
+  if (span < chunks) chunks = span;
+  if (chunks < 2) return conditions;
+  uint64 step = span / chunks;
+
+  string previous_boundary;
+  for (uint64 i = 1; i < chunks; ++i) {
+    uint64 boundary_value = min + i * step;
+    string boundary =
+        is_unsigned ? std::to_string(boundary_value)
+                    : std::to_string(static_cast<int64>(boundary_value));
+    if (previous_boundary.empty())
+      conditions.push_back(quoted_column + " < " + boundary);
+    else
+      conditions.push_back(quoted_column + " >= " + previous_boundary +
+                           " AND " + quoted_column + " < " + boundary);
+    previous_boundary = boundary;
+  }
+  conditions.push_back(quoted_column + " >= " + previous_boundary);
+  return conditions;
+}
+
+void Mysql_crawler::enumerate_table_triggers(
+    const Table &table, const vector<Abstract_dump_task *> &dependencies) {
   // Triggers were supported since 5.0.9
   if (this->get_server_version() < 50009) return;
 
@@ -532,7 +636,8 @@ void Mysql_crawler::enumerate_table_triggers(const Table &table,
             "\n//\n" + "DELIMITER ;\n",
         &table);
 
-    trigger->add_dependency(dependency);
+    for (Abstract_dump_task *dependency : dependencies)
+      trigger->add_dependency(dependency);
     m_current_database_end_dump_task->add_dependency(trigger);
 
     this->process_dump_task(trigger);
@@ -542,7 +647,7 @@ void Mysql_crawler::enumerate_table_triggers(const Table &table,
 }
 
 void Mysql_crawler::enumerate_column_statistics(
-    const Table &table, Abstract_dump_task *dependency) {
+    const Table &table, const vector<Abstract_dump_task *> &dependencies) {
   // Column statistics were supported since 8.0.2
   if (this->get_server_version() < 80002) return;
 
@@ -583,7 +688,8 @@ void Mysql_crawler::enumerate_column_statistics(
     Column_statistic *column_statistic = new Column_statistic(
         this->generate_new_object_id(), table.get_schema(), definition, &table);
 
-    column_statistic->add_dependency(dependency);
+    for (Abstract_dump_task *dependency : dependencies)
+      column_statistic->add_dependency(dependency);
     m_current_database_end_dump_task->add_dependency(column_statistic);
 
     this->process_dump_task(column_statistic);
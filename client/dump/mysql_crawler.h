@@ -26,9 +26,12 @@
 #define MYSQL_CRAWLER_INCLUDED
 
 #include <functional>
+#include <string>
+#include <vector>
 
 #include "client/base/abstract_program.h"
 #include "client/base/message_data.h"
+#include "client/base/mysql_query_runner.h"
 #include "client/dump/abstract_crawler.h"
 #include "client/dump/abstract_dump_task.h"
 #include "client/dump/abstract_mysql_chain_element_extension.h"
@@ -90,11 +93,20 @@ class Mysql_crawler : public Abstract_crawler,
 
   void enumerate_tables(const Database &db);
 
-  void enumerate_table_triggers(const Table &table,
-                                Abstract_dump_task *dependency);
+  /**
+    Returns conditions splitting rows of the table into primary key ranges
+    of about --table-chunk-rows rows each, or empty vector if the table is
+    to be dumped as a whole. Only tables with a single-column integer
+    primary key are split.
+   */
+  std::vector<std::string> get_table_chunk_conditions(
+      Mysql::Tools::Base::Mysql_query_runner *runner, const Table &table);
+
+  void enumerate_table_triggers(
+      const Table &table, const std::vector<Abstract_dump_task *> &dependencies);
 
-  void enumerate_column_statistics(const Table &table,
-                                   Abstract_dump_task *dependency);
+  void enumerate_column_statistics(
+      const Table &table, const std::vector<Abstract_dump_task *> &dependencies);
 
   void enumerate_views(const Database &db);
 
@@ -291,6 +291,13 @@ void Mysqldump_tool_chain_maker_options::create_options() {
   this->create_new_option(&m_skip_rows_data, "skip-dump-rows",
                           "Skip dumping rows of all tables to output.")
       ->set_short_character('d');
+  this->create_new_option(
+          &m_table_chunk_rows, "table-chunk-rows",
+          "Split rows of each table with more than N rows and a single-column "
+          "integer primary key into primary key ranges of about N rows, so "
+          "that they can be dumped by several threads of the same queue "
+          "concurrently. 0 disables splitting.")
+      ->set_value(0);
 }
 
 Mysqldump_tool_chain_maker_options::~Mysqldump_tool_chain_maker_options() {
@@ -68,6 +68,7 @@ class Mysqldump_tool_chain_maker_options
   Mysql::Nullable<std::string> m_result_file;
   Mysql::Nullable<std::string> m_compress_output_algorithm;
   bool m_skip_rows_data;
+  uint64 m_table_chunk_rows;
 
  private:
   void parallel_schemas_callback(char *);
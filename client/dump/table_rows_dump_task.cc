@@ -26,5 +26,15 @@
 
 using namespace Mysql::Tools::Dump;
 
-Table_rows_dump_task::Table_rows_dump_task(Table *related_table)
-    : Abstract_table_dump_task(related_table) {}
+Table_rows_dump_task::Table_rows_dump_task(Table *related_table,
+                                           const std::string &where_condition,
+                                           size_t chunk_count)
+    : Abstract_table_dump_task(related_table),
+      m_where_condition(where_condition),
+      m_chunk_count(chunk_count) {}
+
+const std::string &Table_rows_dump_task::get_where_condition() const {
+  return m_where_condition;
+}
+
+size_t Table_rows_dump_task::get_chunk_count() const { return m_chunk_count; }
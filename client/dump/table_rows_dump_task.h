@@ -25,6 +25,8 @@
 #ifndef TABLE_ROWS_DUMP_TASK_INCLUDED
 #define TABLE_ROWS_DUMP_TASK_INCLUDED
 
+#include <string>
+
 #include "client/dump/abstract_table_dump_task.h"
 
 namespace Mysql {
@@ -32,11 +34,30 @@ namespace Tools {
 namespace Dump {
 
 /**
-  Represents task for extracting rows of single DB table.
+  Represents task for extracting rows of single DB table, or of a range of
+  its rows when the table is dumped in chunks.
  */
 class Table_rows_dump_task : public Abstract_table_dump_task {
  public:
-  Table_rows_dump_task(Table *related_table);
+  Table_rows_dump_task(Table *related_table,
+                       const std::string &where_condition = "",
+                       size_t chunk_count = 1);
+
+  /**
+    Returns condition selecting rows of the chunk, or empty string if all
+    rows of the table are to be dumped.
+   */
+  const std::string &get_where_condition() const;
+
+  /**
+    Returns number of rows tasks the table is dumped with, 1 if it is not
+    dumped in chunks.
+   */
+  size_t get_chunk_count() const;
+
+ private:
+  std::string m_where_condition;
+  size_t m_chunk_count;
 };
 
 }  // namespace Dump
@@ -2389,6 +2389,117 @@ static Exit_status dump_single_log(PRINT_EVENT_INFO *print_event_info,
   return rc;
 }
 
+/**
+  Reads the Previous_gtids_log_event at the start of a local binary log.
+
+  @param logname Name of the binary log file.
+  @param[out] gtids Set the GTIDs of the event are added to.
+  @param[out] is_relay_log Set to true if the file is a relay log.
+
+  @retval true The event was found and added to gtids.
+  @retval false The file could not be read or has no such event.
+*/
+static bool read_previous_gtids(const char *logname, Gtid_set *gtids,
+                                bool *is_relay_log) {
+  ulong max_event_size = 0;
+  mysql_get_option(nullptr, MYSQL_OPT_MAX_ALLOWED_PACKET, &max_event_size);
+  Mysqlbinlog_file_reader mysqlbinlog_file_reader(opt_verify_binlog_checksum,
+                                                  max_event_size);
+
+  Format_description_log_event *fdle = nullptr;
+  if (mysqlbinlog_file_reader.open(logname, BIN_LOG_HEADER_SIZE, &fdle))
+    return false;
+  *is_relay_log = fdle != nullptr && fdle->is_relay_log_event();
+  delete fdle;
+
+  /* The event follows the format description and rotate events, if any. */
+  for (;;) {
+    Log_event *ev = mysqlbinlog_file_reader.read_event_object();
+    if (ev == nullptr) return false;
+
+    Log_event_type type = ev->get_type_code();
+    bool found = false;
+    if (ev->is_relay_log_event()) *is_relay_log = true;
+    if (type == binary_log::PREVIOUS_GTIDS_LOG_EVENT) {
+      global_sid_lock->rdlock();
+      found = down_cast<Previous_gtids_log_event *>(ev)->add_to_set(gtids) ==
+              0;
+      global_sid_lock->unlock();
+    }
+    delete ev;
+
+    if (type == binary_log::PREVIOUS_GTIDS_LOG_EVENT) return found;
+    if (type != binary_log::FORMAT_DESCRIPTION_EVENT &&
+        type != binary_log::ROTATE_EVENT)
+      return false;
+  }
+}
+
+/**
+  Checks whether a local binary log can be skipped as a whole because none
+  of its transactions passes --include-gtids and --exclude-gtids.
+
+  The GTIDs written to a file are bounded by those in the
+  Previous_gtids_log_event of the next file that are not in its own. This
+  only holds when the next file really follows it, so the check requires
+  the Previous_gtids of the file to be a subset of those of the next file,
+  and warns otherwise. If files in between are missing, the difference is
+  larger than the file's own GTIDs, which keeps the check safe.
+
+  --include-gtids is required: it also filters out anonymous transactions,
+  which the Previous_gtids events do not account for. With it, the file is
+  skipped when every GTID of the difference is either not included or
+  excluded.
+
+  Relay logs are never skipped, since a transaction can span several relay
+  log files and shall_skip_gtids() carries its filtering state over.
+
+  @param logname Name of the binary log file to check.
+  @param next_logname Name of the binary log file given after it.
+
+  @return true if the file can be skipped, false otherwise.
+*/
+static bool shall_skip_log_by_gtids(const char *logname,
+                                    const char *next_logname) {
+  if (opt_remote_proto != BINLOG_LOCAL || opt_include_gtids_str == nullptr ||
+      strcmp(logname, "-") == 0 || strcmp(next_logname, "-") == 0)
+    return false;
+
+  Gtid_set previous_gtids(global_sid_map);
+  Gtid_set logged_gtids(global_sid_map);
+  bool is_relay_log = false;
+  bool next_is_relay_log = false;
+  if (!read_previous_gtids(logname, &previous_gtids, &is_relay_log) ||
+      !read_previous_gtids(next_logname, &logged_gtids, &next_is_relay_log) ||
+      is_relay_log || next_is_relay_log)
+    return false;
+
+  global_sid_lock->rdlock();
+
+  if (!previous_gtids.is_subset(&logged_gtids)) {
+    global_sid_lock->unlock();
+    warning(
+        "The binary logs %s and %s are not given in order; "
+        "%s is read in full.",
+        logname, next_logname, logname);
+    return false;
+  }
+
+  logged_gtids.remove_gtid_set(&previous_gtids);
+
+  Gtid_set selected_gtids(global_sid_map);
+  bool skip = false;
+  if (logged_gtids.intersection(gtid_set_included, &selected_gtids) ==
+      RETURN_STATUS_OK) {
+    if (opt_exclude_gtids_str != nullptr)
+      selected_gtids.remove_gtid_set(gtid_set_excluded);
+    skip = selected_gtids.is_empty();
+  }
+
+  global_sid_lock->unlock();
+  return skip;
+}
+
 static Exit_status dump_multiple_logs(int argc, char **argv) {
   DBUG_TRACE;
   Exit_status rc = OK_CONTINUE;
@@ -2417,7 +2528,12 @@ static Exit_status dump_multiple_logs(int argc, char **argv) {
   for (int i = 0; i < argc; i++) {
     if (i == argc - 1)  // last log, --stop-position applies
       stop_position = save_stop_position;
-    if ((rc = dump_single_log(&print_event_info, argv[i])) != OK_CONTINUE)
+    if (i < argc - 1 && shall_skip_log_by_gtids(argv[i], argv[i + 1])) {
+      fprintf(result_file,
+              "# Skipped %s: no transaction matches the GTID filters\n",
+              argv[i]);
+    } else if ((rc = dump_single_log(&print_event_info, argv[i])) !=
+               OK_CONTINUE)
       break;
 
     // For next log, --start-position does not apply
@@ -138,6 +138,17 @@ uint master_wakeup;
 native_mutex_t sleeper_mutex;
 native_cond_t sleep_threshold;
 
+/*
+  Query latency histogram, in microseconds. Each power of two is split into
+  LATENCY_SUB_BUCKETS linear buckets, so percentiles are reported with a
+  relative error below 1/LATENCY_SUB_BUCKETS. Threads fill a local copy and
+  merge it under counter_mutex when they finish.
+*/
+#define LATENCY_SUB_BUCKETS_LOG2 4
+#define LATENCY_SUB_BUCKETS (1U << LATENCY_SUB_BUCKETS_LOG2)
+#define LATENCY_BUCKETS (64 * LATENCY_SUB_BUCKETS)
+static ulonglong latency_histogram[LATENCY_BUCKETS];
+
 char **primary_keys;
 unsigned long long primary_keys_number_of;
 
@@ -252,6 +263,10 @@ struct conclusions {
   long int min_timing;
   uint users;
   unsigned long long avg_rows;
+  /* Query latency percentiles, in microseconds */
+  ulonglong p50_latency;
+  ulonglong p99_latency;
+  ulonglong p999_latency;
   /* The following are not used yet */
   unsigned long long max_rows;
   unsigned long long min_rows;
@@ -305,6 +320,36 @@ static long int timedif(struct timeval a, struct timeval b) {
   return s + us;
 }
 
+static uint latency_bucket(ulonglong latency) {
+  if (latency < LATENCY_SUB_BUCKETS) return (uint)latency;
+
+  uint msb = 0;
+  for (ulonglong v = latency; v > 1; v >>= 1) msb++;
+  uint shift = msb - LATENCY_SUB_BUCKETS_LOG2;
+  return (shift + 1) * LATENCY_SUB_BUCKETS +
+         (uint)((latency >> shift) - LATENCY_SUB_BUCKETS);
+}
+
+static ulonglong latency_bucket_value(uint bucket) {
+  if (bucket < LATENCY_SUB_BUCKETS) return bucket;
+
+  uint shift = bucket / LATENCY_SUB_BUCKETS - 1;
+  return (ulonglong)(LATENCY_SUB_BUCKETS + bucket % LATENCY_SUB_BUCKETS)
+         << shift;
+}
+
+static ulonglong latency_percentile(ulonglong total, double percentile) {
+  ulonglong rank = (ulonglong)(total * percentile / 100);
+  ulonglong seen = 0;
+
+  if (rank >= total) rank = total - 1;
+  for (uint x = 0; x < LATENCY_BUCKETS; x++) {
+    seen += latency_histogram[x];
+    if (seen > rank) return latency_bucket_value(x);
+  }
+  return 0;
+}
+
 #ifdef _WIN32
 static int gettimeofday(struct timeval *tp, void *tzp) {
   unsigned int ticks;
@@ -458,6 +503,7 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr) {
                          MYF(MY_ZEROFILL | MY_FAE | MY_WME));
 
   memset(&conclusion, 0, sizeof(conclusions));
+  memset(latency_histogram, 0, sizeof(latency_histogram));
 
   if (auto_actual_queries)
     client_limit = auto_actual_queries;
@@ -1689,6 +1735,10 @@ extern "C" void *run_task(void *p) {
   MYSQL_ROW row;
   statement *ptr;
   thread_context *con = (thread_context *)p;
+  ulonglong query_start;
+  ulonglong *histogram = (ulonglong *)my_malloc(
+      PSI_NOT_INSTRUMENTED, sizeof(latency_histogram),
+      MYF(MY_ZEROFILL | MY_FAE | MY_WME));
 
   {
     DBUG_TRACE;
@@ -1762,6 +1812,7 @@ extern "C" void *run_task(void *p) {
           want a crash so the if() is placed here.
         */
         assert(primary_keys_number_of);
+        query_start = my_micro_time();
         if (primary_keys_number_of) {
           key_val = (unsigned int)(random() % primary_keys_number_of);
           key = primary_keys[key_val];
@@ -1778,6 +1829,7 @@ extern "C" void *run_task(void *p) {
           }
         }
       } else {
+        query_start = my_micro_time();
         if (run_query(mysql, ptr->string, ptr->length)) {
           fprintf(stderr, "%s: Cannot run query %.*s ERROR : %s\n", my_progname,
                   (uint)ptr->length, ptr->string, mysql_error(mysql));
@@ -1796,6 +1848,7 @@ extern "C" void *run_task(void *p) {
           }
         }
       } while (mysql_next_result(mysql) == 0);
+      histogram[latency_bucket(my_micro_time() - query_start)]++;
       queries++;
 
       if (commit_rate && (++commit_counter == commit_rate)) {
@@ -1816,9 +1869,12 @@ extern "C" void *run_task(void *p) {
     mysql_thread_end();
 
     native_mutex_lock(&counter_mutex);
+    for (uint x = 0; x < LATENCY_BUCKETS; x++)
+      latency_histogram[x] += histogram[x];
     thread_counter--;
     native_cond_signal(&count_threshold);
     native_mutex_unlock(&counter_mutex);
+    my_free(histogram);
   }
   my_thread_exit(nullptr);
   return nullptr;
@@ -1980,6 +2036,13 @@ void print_conclusions(conclusions *con) {
          con->max_timing / 1000, con->max_timing % 1000);
   printf("\tNumber of clients running queries: %d\n", con->users);
   printf("\tAverage number of queries per client: %llu\n", con->avg_rows);
+  if (con->p50_latency || con->p99_latency || con->p999_latency)
+    printf(
+        "\tQuery latency p50/p99/p99.9: %llu.%03llu/%llu.%03llu/%llu.%03llu "
+        "milliseconds\n",
+        con->p50_latency / 1000, con->p50_latency % 1000,
+        con->p99_latency / 1000, con->p99_latency % 1000,
+        con->p999_latency / 1000, con->p999_latency % 1000);
   printf("\n");
 }
 
@@ -2021,6 +2084,14 @@ void generate_stats(conclusions *con, option_string *eng, stats *sptr) {
   }
   con->avg_timing = con->avg_timing / iterations;
 
+  ulonglong total_queries = 0;
+  for (x = 0; x < LATENCY_BUCKETS; x++) total_queries += latency_histogram[x];
+  if (total_queries) {
+    con->p50_latency = latency_percentile(total_queries, 50);
+    con->p99_latency = latency_percentile(total_queries, 99);
+    con->p999_latency = latency_percentile(total_queries, 99.9);
+  }
+
   if (eng && eng->string)
     con->engine = eng->string;
   else
@@ -79,6 +79,7 @@ struct MEM_ROOT {
  private:
   struct Block {
     Block *prev{nullptr}; /** Previous block; used for freeing. */
+    size_t length{0};     /** Usable bytes; used for reusing the block. */
   };
 
  public:
@@ -352,7 +353,10 @@ struct MEM_ROOT {
   /** Allocate memory that doesn't fit into the current free block. */
   void *AllocSlow(size_t length);
 
-  /** Free all blocks in a linked list, starting at the given block. */
+  /**
+    Free all blocks in a linked list, starting at the given block. Small
+    blocks are kept for reuse by the calling thread.
+  */
   static void FreeBlocks(Block *start);
 
   /** The current block we are giving out memory from. nullptr if none. */
@@ -399,6 +403,34 @@ static inline void init_alloc_root(PSI_memory_key key, MEM_ROOT *root,
 
 void free_root(MEM_ROOT *root, myf flags);
 
+/**
+ * Upper bound, in bytes, on the freed MEM_ROOT blocks that each thread keeps
+ * for reuse. 0, the default, disables the cache. Set by the server through
+ * the mem_root_block_cache_size system variable.
+ */
+extern ulong mem_root_block_cache_size;
+
+/**
+ * Let the calling thread keep freed MEM_ROOT blocks for reuse.
+ * Called by my_thread_init().
+ */
+void init_root_block_cache();
+
+/**
+ * Free the MEM_ROOT blocks the calling thread keeps for reuse, and stop
+ * keeping new ones. Called by my_thread_end().
+ */
+void free_root_block_cache();
+
+/**
+ * Free the MEM_ROOT blocks the calling thread keeps for reuse, but keep
+ * caching new ones. Called when a connection thread goes idle.
+ */
+void flush_root_block_cache();
+
+/** Bytes in the MEM_ROOT blocks the calling thread keeps for reuse. */
+size_t root_block_cache_bytes();
+
 /**
  * Allocate an object of the given type. Use like this:
  *
@@ -60,12 +60,19 @@ typedef unsigned int PSI_statement_key;
 */
 #define PSI_STATEMENT_VERSION_2 2
 
+/**
+  @def PSI_STATEMENT_VERSION_3
+  Performance Schema Statement Interface number for version 3.
+  This version is supported.
+*/
+#define PSI_STATEMENT_VERSION_3 3
+
 /**
   @def PSI_CURRENT_STATEMENT_VERSION
   Performance Schema Statement Interface number for the most recent version.
-  The most current version is @c PSI_STATEMENT_VERSION_2
+  The most current version is @c PSI_STATEMENT_VERSION_3
 */
-#define PSI_CURRENT_STATEMENT_VERSION 2
+#define PSI_CURRENT_STATEMENT_VERSION 3
 
 /**
   Interface for an instrumented statement.
@@ -204,6 +211,84 @@ struct PSI_statement_locker_state_v1 {
 };
 typedef struct PSI_statement_locker_state_v1 PSI_statement_locker_state_v1;
 
+/**
+  State data storage for @c get_thread_statement_locker_v3_t.
+  This structure has the same layout as @c PSI_statement_locker_state_v1,
+  with extra members added at the end.
+  @since PSI_STATEMENT_VERSION_3
+  @sa get_thread_statement_locker_v3_t
+*/
+struct PSI_statement_locker_state_v3 {
+  /** Discarded flag. */
+  bool m_discarded;
+  /** In prepare flag. */
+  bool m_in_prepare;
+  /** Metric, no index used flag. */
+  unsigned char m_no_index_used;
+  /** Metric, no good index used flag. */
+  unsigned char m_no_good_index_used;
+  /** Internal state. */
+  unsigned int m_flags;
+  /** Instrumentation class. */
+  void *m_class;
+  /** Current thread. */
+  struct PSI_thread *m_thread;
+  /** Timer start. */
+  unsigned long long m_timer_start;
+  /** Timer function. */
+  unsigned long long (*m_timer)(void);
+  /** Internal data. */
+  void *m_statement;
+  /** Locked time. */
+  unsigned long long m_lock_time;
+  /** Rows sent. */
+  unsigned long long m_rows_sent;
+  /** Rows examined. */
+  unsigned long long m_rows_examined;
+  /** Metric, temporary tables created on disk. */
+  unsigned long m_created_tmp_disk_tables;
+  /** Metric, temporary tables created. */
+  unsigned long m_created_tmp_tables;
+  /** Metric, number of select full join. */
+  unsigned long m_select_full_join;
+  /** Metric, number of select full range join. */
+  unsigned long m_select_full_range_join;
+  /** Metric, number of select range. */
+  unsigned long m_select_range;
+  /** Metric, number of select range check. */
+  unsigned long m_select_range_check;
+  /** Metric, number of select scan. */
+  unsigned long m_select_scan;
+  /** Metric, number of sort merge passes. */
+  unsigned long m_sort_merge_passes;
+  /** Metric, number of sort merge. */
+  unsigned long m_sort_range;
+  /** Metric, number of sort rows. */
+  unsigned long m_sort_rows;
+  /** Metric, number of sort scans. */
+  unsigned long m_sort_scan;
+  /** Statement digest. */
+  const struct sql_digest_storage *m_digest;
+  /** Current schema name. */
+  char m_schema_name[PSI_SCHEMA_NAME_LEN];
+  /** Length in bytes of @c m_schema_name. */
+  unsigned int m_schema_name_length;
+  /** Statement character set number. */
+  unsigned int m_cs_number;
+  /** Statement query sample. */
+  const char *m_query_sample;
+  /** Length in bytes of @c m_query_sample. */
+  unsigned int m_query_sample_length;
+  /** True if @c m_query_sample was truncated. */
+  bool m_query_sample_truncated;
+
+  PSI_sp_share *m_parent_sp_share;
+  PSI_prepared_stmt *m_parent_prepared_stmt;
+  /** Thread CPU time at statement start, in nanoseconds. */
+  unsigned long long m_cpu_time_start;
+};
+typedef struct PSI_statement_locker_state_v3 PSI_statement_locker_state_v3;
+
 struct PSI_sp_locker_state_v1 {
   /** Internal state. */
   unsigned int m_flags;
@@ -240,6 +325,19 @@ typedef struct PSI_statement_locker *(*get_thread_statement_locker_v1_t)(
     struct PSI_statement_locker_state_v1 *state, PSI_statement_key key,
     const void *charset, PSI_sp_share *sp_share);
 
+/**
+  Get a statement instrumentation locker.
+  @param state data storage for the locker
+  @param key the statement instrumentation key
+  @param charset client character set
+  @param sp_share Parent stored procedure share, if any.
+  @return a statement locker, or NULL
+  @since PSI_STATEMENT_VERSION_3
+*/
+typedef struct PSI_statement_locker *(*get_thread_statement_locker_v3_t)(
+    struct PSI_statement_locker_state_v3 *state, PSI_statement_key key,
+    const void *charset, PSI_sp_share *sp_share);
+
 /**
   Refine a statement locker to a more specific key.
   Note that only events declared mutable can be refined.
@@ -509,7 +607,7 @@ typedef void (*drop_sp_v1_t)(unsigned int object_type, const char *schema_name,
                              unsigned int object_name_length);
 
 typedef struct PSI_statement_info_v1 PSI_statement_info;
-typedef struct PSI_statement_locker_state_v1 PSI_statement_locker_state;
+typedef struct PSI_statement_locker_state_v3 PSI_statement_locker_state;
 typedef struct PSI_sp_locker_state_v1 PSI_sp_locker_state;
 
 /** @} (end of group psi_abi_statement) */
@@ -113,6 +113,30 @@ static const EVP_CIPHER *aes_evp_type(const my_aes_opmode mode) {
   }
 }
 
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+namespace {
+/**
+  Cipher context reused by every my_aes_encrypt()/my_aes_decrypt() call
+  made by a thread, instead of allocating a fresh one per call. The context
+  is reset after each use, which also wipes the key schedule.
+*/
+class Thread_cipher_ctx {
+ public:
+  ~Thread_cipher_ctx() { EVP_CIPHER_CTX_free(m_ctx); }
+
+  EVP_CIPHER_CTX *get() {
+    if (m_ctx == nullptr) m_ctx = EVP_CIPHER_CTX_new();
+    return m_ctx;
+  }
+
+ private:
+  EVP_CIPHER_CTX *m_ctx{nullptr};
+};
+
+thread_local Thread_cipher_ctx thread_cipher_ctx;
+}  // namespace
+#endif /* OPENSSL_VERSION_NUMBER >= 0x10100000L */
+
 int my_aes_encrypt(const unsigned char *source, uint32 source_length,
                    unsigned char *dest, const unsigned char *key,
                    uint32 key_length, enum my_aes_opmode mode,
@@ -121,7 +145,7 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
   EVP_CIPHER_CTX stack_ctx;
   EVP_CIPHER_CTX *ctx = &stack_ctx;
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *ctx = thread_cipher_ctx.get();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
@@ -142,7 +166,7 @@ int my_aes_encrypt(const unsigned char *source, uint32 source_length,
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return u_len + f_len;
 
@@ -152,7 +176,7 @@ aes_error:
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return MY_AES_BAD_DATA;
 }
@@ -165,7 +189,7 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
   EVP_CIPHER_CTX stack_ctx;
   EVP_CIPHER_CTX *ctx = &stack_ctx;
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *ctx = thread_cipher_ctx.get();
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   const EVP_CIPHER *cipher = aes_evp_type(mode);
   int u_len, f_len;
@@ -188,7 +212,7 @@ int my_aes_decrypt(const unsigned char *source, uint32 source_length,
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
 
   return u_len + f_len;
@@ -199,7 +223,7 @@ aes_error:
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
   EVP_CIPHER_CTX_cleanup(ctx);
 #else  /* OPENSSL_VERSION_NUMBER < 0x10100000L */
-  EVP_CIPHER_CTX_free(ctx);
+  EVP_CIPHER_CTX_reset(ctx);
 #endif /* OPENSSL_VERSION_NUMBER < 0x10100000L */
   return MY_AES_BAD_DATA;
 }
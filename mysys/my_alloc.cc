@@ -34,6 +34,7 @@
 #include <stdarg.h>
 #include <string.h>
 #include <sys/types.h>
+#include <type_traits>
 
 #include "my_alloc.h"
 #include "my_compiler.h"
@@ -42,6 +43,7 @@
 #include "my_pointer_arithmetic.h"
 #include "my_sys.h"
 #include "mysql/service_mysql_alloc.h"
+#include "mysys/mysys_priv.h"
 #include "mysys_err.h"
 #include "template_utils.h"
 
@@ -53,6 +55,90 @@
 #define MEM_ROOT_SINGLE_CHUNKS 0
 #endif
 
+ulong mem_root_block_cache_size = 0;
+
+namespace {
+
+/**
+ * Blocks freed by MEM_ROOTs on this thread, kept for the next MEM_ROOT on
+ * the same thread that wants a block of the same size. Memory roots that
+ * are cleared after every statement then reuse their blocks instead of
+ * doing a malloc()/free() pair per block per statement.
+ *
+ * A cached block is accounted under key_memory_MEM_ROOT_block_cache, and
+ * under the key of its new MEM_ROOT once it is reused. The cache only
+ * takes blocks between my_thread_init() and my_thread_end(), and it has
+ * no destructor, so nothing is freed after the thread or the
+ * instrumentation has been torn down.
+ */
+class Block_cache {
+ public:
+  void enable() { m_enabled = true; }
+
+  void disable() {
+    clear();
+    m_enabled = false;
+  }
+
+  void *get(size_t length, PSI_memory_key key) {
+    for (size_t i = 0; i < m_size; ++i) {
+      if (m_entries[i].length == length) {
+        void *block = m_entries[i].block;
+        m_entries[i] = m_entries[--m_size];
+        m_bytes -= length;
+        my_memory_rekey(block, key);
+        return block;
+      }
+    }
+    return nullptr;
+  }
+
+  bool put(void *block, size_t length) {
+    if (!m_enabled || length > MAX_LENGTH || m_size == MAX_ENTRIES ||
+        m_bytes + length > mem_root_block_cache_size)
+      return false;
+    my_memory_rekey(block, key_memory_MEM_ROOT_block_cache);
+    m_entries[m_size++] = {block, length};
+    m_bytes += length;
+    return true;
+  }
+
+  void clear() {
+    while (m_size > 0) my_free(m_entries[--m_size].block);
+    m_bytes = 0;
+  }
+
+  size_t bytes() const { return m_bytes; }
+
+ private:
+  static constexpr size_t MAX_ENTRIES = 8;
+  static constexpr size_t MAX_LENGTH = 64 * 1024;
+
+  struct Entry {
+    void *block;
+    size_t length;
+  };
+  Entry m_entries[MAX_ENTRIES]{};
+  size_t m_size{0};
+  size_t m_bytes{0};
+  bool m_enabled{false};
+};
+
+static_assert(std::is_trivially_destructible<Block_cache>::value,
+              "Block_cache must not free memory at thread exit");
+
+thread_local Block_cache block_cache;
+
+}  // namespace
+
+void init_root_block_cache() { block_cache.enable(); }
+
+void free_root_block_cache() { block_cache.disable(); }
+
+void flush_root_block_cache() { block_cache.clear(); }
+
+size_t root_block_cache_bytes() { return block_cache.bytes(); }
+
 std::pair<MEM_ROOT::Block *, size_t> MEM_ROOT::AllocBlock(
     size_t wanted_length, size_t minimum_length) {
   DBUG_TRACE;
@@ -83,13 +169,20 @@ std::pair<MEM_ROOT::Block *, size_t> MEM_ROOT::AllocBlock(
     }
   }
 
-  Block *new_block = static_cast<Block *>(
-      my_malloc(m_psi_key, length + ALIGN_SIZE(sizeof(Block)),
-                MYF(MY_WME | ME_FATALERROR)));
+  Block *new_block = nullptr;
+  if (!MEM_ROOT_SINGLE_CHUNKS) {
+    new_block = static_cast<Block *>(block_cache.get(length, m_psi_key));
+  }
+  if (new_block == nullptr) {
+    new_block = static_cast<Block *>(
+        my_malloc(m_psi_key, length + ALIGN_SIZE(sizeof(Block)),
+                  MYF(MY_WME | ME_FATALERROR)));
+  }
   if (new_block == nullptr) {
     if (m_error_handler) (m_error_handler)();
     return {nullptr, 0};
   }
+  new_block->length = length;
 
   m_allocated_size += length;
 
@@ -206,7 +299,8 @@ void MEM_ROOT::FreeBlocks(Block *start) {
   // touch it after we've started freeing.
   for (Block *block = start; block != nullptr;) {
     Block *prev = block->prev;
-    my_free(block);
+    if (MEM_ROOT_SINGLE_CHUNKS || !block_cache.put(block, block->length))
+      my_free(block);
     block = prev;
   }
 }
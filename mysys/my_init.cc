@@ -544,7 +544,9 @@ static PSI_memory_info all_mysys_memory[] = {
      PSI_DOCUMENT_ME},
     {&key_memory_MY_DIR, "MY_DIR", 0, 0, PSI_DOCUMENT_ME},
     {&key_memory_DYNAMIC_STRING, "DYNAMIC_STRING", 0, 0, PSI_DOCUMENT_ME},
-    {&key_memory_TREE, "TREE", 0, 0, PSI_DOCUMENT_ME}};
+    {&key_memory_TREE, "TREE", 0, 0, PSI_DOCUMENT_ME},
+    {&key_memory_MEM_ROOT_block_cache, "MEM_ROOT_block_cache", 0, 0,
+     PSI_DOCUMENT_ME}};
 #endif /* HAVE_PSI_MEMORY_INTERFACE */
 
 #ifdef HAVE_PSI_THREAD_INTERFACE
@@ -44,6 +44,7 @@
 #include "mysql/components/services/bits/psi_bits.h"
 #include "mysql/psi/mysql_memory.h"
 #include "mysql/psi/psi_memory.h"
+#include "mysys/mysys_priv.h"
 #include "mysys_err.h"
 
 struct PSI_thread;
@@ -137,6 +138,13 @@ void my_claim(const void *ptr, bool claim) {
       PSI_MEMORY_CALL(memory_claim)(mh->m_key, mh->m_size, &mh->m_owner, claim);
 }
 
+void my_memory_rekey(void *ptr, PSI_memory_key key) {
+  my_memory_header *mh = USER_TO_HEADER(ptr);
+  assert(mh->m_magic == MAGIC);
+  PSI_MEMORY_CALL(memory_free)(mh->m_key, mh->m_size, mh->m_owner);
+  mh->m_key = PSI_MEMORY_CALL(memory_alloc)(key, mh->m_size, &mh->m_owner);
+}
+
 void my_free(void *ptr) {
   my_memory_header *mh;
 
@@ -169,6 +177,10 @@ void my_claim(const void *ptr MY_ATTRIBUTE((unused)),
               bool claim MY_ATTRIBUTE((unused))) { /* Empty */
 }
 
+void my_memory_rekey(void *ptr MY_ATTRIBUTE((unused)),
+                     PSI_memory_key key MY_ATTRIBUTE((unused))) { /* Empty */
+}
+
 void my_free(void *ptr) { my_raw_free(ptr); }
 #endif
 
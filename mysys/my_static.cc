@@ -68,6 +68,7 @@ PSI_memory_key key_memory_MY_DIR;
 PSI_memory_key key_memory_MY_TMPDIR_full_list;
 PSI_memory_key key_memory_DYNAMIC_STRING;
 PSI_memory_key key_memory_TREE;
+PSI_memory_key key_memory_MEM_ROOT_block_cache;
 
 PSI_thread_key key_thread_timer_notifier;
 
@@ -38,6 +38,7 @@
 #endif
 #include <time.h>
 
+#include "my_alloc.h"
 #include "my_dbug.h"
 #include "my_inttypes.h"
 #include "my_loglevel.h"
@@ -277,6 +278,8 @@ extern "C" bool my_thread_init() {
   install_sigabrt_handler();
 #endif
 
+  init_root_block_cache();
+
 #ifndef NDEBUG
   if (mysys_thread_var()) return false;
 
@@ -305,6 +308,9 @@ extern "C" void my_thread_end() {
   struct st_my_thread_var *tmp = mysys_thread_var();
 #endif
 
+  // Free cached memory while the thread is still instrumented.
+  free_root_block_cache();
+
 #ifdef HAVE_PSI_THREAD_INTERFACE
   /*
     Remove the instrumentation for this thread.
@@ -84,6 +84,7 @@ extern PSI_memory_key key_memory_my_file_info;
 extern PSI_memory_key key_memory_MY_DIR;
 extern PSI_memory_key key_memory_DYNAMIC_STRING;
 extern PSI_memory_key key_memory_TREE;
+extern PSI_memory_key key_memory_MEM_ROOT_block_cache;
 extern PSI_memory_key key_memory_defaults;
 
 #ifdef _WIN32
@@ -116,6 +117,12 @@ inline RET RetryOnEintr(SYSC &&sysc, RET err) {
 
 void my_error_unregister_all();
 
+/**
+  Move the performance schema accounting of a block from my_malloc()
+  to another key, and to the calling thread, without freeing it.
+*/
+void my_memory_rekey(void *ptr, PSI_memory_key key);
+
 #ifdef _WIN32
 #include <stdint.h>  // int64_t
 #include <sys/stat.h>
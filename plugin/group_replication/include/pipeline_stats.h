@@ -662,6 +662,13 @@ class Flow_control_module {
   std::atomic<int64> m_quota_used;
   std::atomic<int64> m_quota_size;
 
+  /*
+    Smoothed estimate of the group capacity, in transactions per
+    flow control period, while members are being held. Zero when not
+    throttling. Only accessed from flow_control_step().
+  */
+  int64 m_capacity_estimate;
+
   /*
     Counter incremented on every flow control step.
   */
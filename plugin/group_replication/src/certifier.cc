@@ -24,6 +24,7 @@
 #include <signal.h>
 #include <time.h>
 #include <map>
+#include <unordered_map>
 
 #include <mysql/components/services/log_builtins.h>
 #include "my_dbug.h"
@@ -1131,10 +1132,23 @@ void Certifier::garbage_collect() {
     precedes them), then "t" is stable and can be removed from
     the certification info.
   */
+  /*
+    All write sets of a transaction share its snapshot version, so compare
+    each distinct Gtid_set_ref with the stable set only once.
+  */
+  std::unordered_map<const Gtid_set_ref *, bool> is_stable;
   Certification_info::iterator it = certification_info.begin();
   stable_gtid_set_lock->wrlock();
   while (it != certification_info.end()) {
-    if (it->second->is_subset_not_equals(stable_gtid_set)) {
+    auto stable_it = is_stable.find(it->second);
+    if (stable_it == is_stable.end()) {
+      stable_it =
+          is_stable
+              .emplace(it->second,
+                       it->second->is_subset_not_equals(stable_gtid_set))
+              .first;
+    }
+    if (stable_it->second) {
       if (it->second->unlink() == 0) delete it->second;
       certification_info.erase(it++);
     } else
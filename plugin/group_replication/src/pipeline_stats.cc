@@ -714,6 +714,7 @@ Flow_control_module::Flow_control_module()
     : m_holds_in_period(0),
       m_quota_used(0),
       m_quota_size(0),
+      m_capacity_estimate(0),
       m_stamp(0),
       seconds_to_skip(1) {
   mysql_mutex_init(key_GR_LOCK_pipeline_stats_flow_control,
@@ -867,8 +868,19 @@ void Flow_control_module::flow_control_step(
         if (get_flow_control_min_quota_var() > 0)
           lim_throttle = get_flow_control_min_quota_var();
 
-        min_capacity =
-            std::max(std::min(min_capacity, safe_capacity), lim_throttle);
+        min_capacity = std::min(min_capacity, safe_capacity);
+
+        /*
+          The capacity measured on a single period is noisy, and the next
+          quota derived from it directly makes the writers' throughput
+          oscillate. Average it with the estimate from the previous held
+          periods, giving the latest measurement half of the weight.
+        */
+        if (m_capacity_estimate > 0 && min_capacity < MAXTPS)
+          min_capacity = (min_capacity + m_capacity_estimate) / 2;
+        m_capacity_estimate = min_capacity < MAXTPS ? min_capacity : 0;
+
+        min_capacity = std::max(min_capacity, lim_throttle);
         quota_size = static_cast<int64>(min_capacity * HOLD_FACTOR);
 
         if (max_quota > 0) quota_size = std::min(quota_size, max_quota);
@@ -891,6 +903,8 @@ void Flow_control_module::flow_control_step(
                      min_capacity, lim_throttle);
 #endif
       } else {
+        m_capacity_estimate = 0;
+
         if (quota_size > 0 && get_flow_control_release_percent_var() > 0 &&
             (quota_size * RELEASE_FACTOR) < MAXTPS) {
           int64 quota_size_next =
@@ -913,6 +927,7 @@ void Flow_control_module::flow_control_step(
     case FCM_DISABLED:
       m_quota_size.store(0);
       m_quota_used.store(0);
+      m_capacity_estimate = 0;
       break;
 
     default:
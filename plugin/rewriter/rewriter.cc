@@ -189,9 +189,17 @@ Rewrite_result Rewriter::rewrite_query(MYSQL_THD thd, const uchar *key) {
   bool digest_matched = false;
 
   auto it_range = m_digests.equal_range(hash_key_from_digest(key));
+  if (it_range.first == it_range.second) return result;
+
+  /*
+    Printing the normalized query walks the whole parse tree, so do it once
+    for all the rules sharing this digest.
+  */
+  std::string normalized_query = services::get_current_query_normalized(thd);
+
   for (auto it = it_range.first; it != it_range.second; ++it) {
     Rule *rule = it->second.get();
-    if (rule->matches(thd)) {
+    if (rule->matches(normalized_query)) {
       result = rule->create_new_query(thd);
       if (result.was_rewritten) return result;
     } else {
@@ -177,7 +177,6 @@ Rewrite_result Rule::create_new_query(MYSQL_THD thd) {
   return result;
 }
 
-bool Rule::matches(MYSQL_THD thd) const {
-  string normalized_query = services::get_current_query_normalized(thd);
+bool Rule::matches(const string &normalized_query) const {
   return normalized_query.compare(m_pattern.normalized_pattern) == 0;
 }
@@ -174,14 +174,16 @@ class Rule {
   Rewrite_result create_new_query(MYSQL_THD thd);
 
   /**
-    Asks the parser service for the current query in normalized form and
-    compares it to the normalized pattern. This is the equivalent of comparing
+    Compares the current query in normalized form, as obtained from the parser
+    service, to the normalized pattern. This is the equivalent of comparing
     the structure of two parse trees.
 
+    @param normalized_query The current query in normalized form.
+
     @return True if the normalized pattern matches the current normalized
     query, otherwise false.
   */
-  bool matches(MYSQL_THD thd) const;
+  bool matches(const std::string &normalized_query) const;
 
   std::string pattern_parse_error_message() {
     return m_pattern.parse_error_message();
@@ -243,6 +243,7 @@ static void init_net(NET *net, unsigned char *buff, unsigned int buff_len) {
 void Ack_receiver::run() {
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  unsigned char reply_buff[REPLY_MESSAGE_MAX_LENGTH];
   uint i;
   Socket_listener listener;
 
@@ -308,16 +309,32 @@ void Ack_receiver::run() {
             (server_extension->compress_ctx.algorithm == MYSQL_ZLIB) ||
             (server_extension->compress_ctx.algorithm == MYSQL_ZSTD);
 
+        /*
+          A slave acknowledges positions in increasing order, so when
+          several replies are already buffered on its socket only the
+          last one matters. Drain them and report just that one, so that
+          LOCK_binlog_ is taken once per wakeup instead of once per reply.
+        */
+        ulong reply_len = 0;
         do {
           net_clear(&net, false);
 
           len = my_net_read(&net);
-          if (likely(len != packet_error))
-            repl_semisync->reportReplyPacket(slave_obj.server_id, net.read_pos,
-                                             len);
-          else if (net.last_errno == ER_NET_READ_ERROR)
+          if (likely(len != packet_error)) {
+            if (likely(len <= sizeof(reply_buff))) {
+              memcpy(reply_buff, net.read_pos, len);
+              reply_len = len;
+            } else {
+              repl_semisync->reportReplyPacket(slave_obj.server_id,
+                                               net.read_pos, len);
+            }
+          } else if (net.last_errno == ER_NET_READ_ERROR)
             listener.clear_socket_info(i);
         } while (net.vio->has_data(net.vio) && m_status == ST_UP);
+
+        if (reply_len > 0)
+          repl_semisync->reportReplyPacket(slave_obj.server_id, reply_buff,
+                                           reply_len);
       }
       i++;
     }
@@ -145,11 +145,13 @@ bool Scheduler_dynamic::post(Task *task) {
         return false;
       }
     }
-  }
 
-  while (m_tasks.push(task) == false) {
+    // Queue and wake a worker under the same lock, so that posting a task
+    // takes the pending mutex once.
+    while (m_tasks.push(task) == false) {
+    }
+    m_worker_pending_cond.signal();
   }
-  m_worker_pending_cond.signal(m_worker_pending_mutex);
 
   return true;
 }
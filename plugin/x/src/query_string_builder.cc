@@ -106,8 +106,47 @@ Query_string_builder &Query_string_builder::escape_string(const char *s,
   // resize the buffer to fit the original size + worst case length of s
   m_str.resize(str_pos + 2 * length + 1);
 
-  size_t r = escape_string_for_mysql(m_charset, &m_str[str_pos], 2 * length + 1,
-                                     s, length);
+  // ASCII is never part of a multi-byte utf8mb4 character, so it needs only
+  // the single-byte escapes of escape_string_for_mysql(). Inline them and
+  // leave the per-character charset calls to the first non-ASCII byte.
+  char *out = &m_str[str_pos];
+  size_t idx = 0;
+  for (; idx < length; ++idx) {
+    const char c = s[idx];
+    if (static_cast<unsigned char>(c) >= 0x80) break;
+
+    char escape = 0;
+    switch (c) {
+      case 0:
+        escape = '0';
+        break;
+      case '\n':
+        escape = 'n';
+        break;
+      case '\r':
+        escape = 'r';
+        break;
+      case '\\':
+      case '\'':
+      case '"':
+        escape = c;
+        break;
+      case '\032':
+        escape = 'Z';
+        break;
+    }
+    if (escape) {
+      *out++ = '\\';
+      *out++ = escape;
+    } else {
+      *out++ = c;
+    }
+  }
+
+  size_t r = out - &m_str[str_pos];
+  if (idx < length)
+    r += escape_string_for_mysql(m_charset, out, 2 * (length - idx) + 1,
+                                 s + idx, length - idx);
   m_str.resize(str_pos + r);
 
   return *this;
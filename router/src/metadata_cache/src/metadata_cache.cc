@@ -27,6 +27,7 @@
 #include <cassert>
 #include <cmath>  // fabs()
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <vector>
 
@@ -102,6 +103,11 @@ void MetadataCache::refresh_thread() {
 
   auto auth_cache_ttl_left = auth_cache_refresh_interval_;
   bool auth_cache_force_update = true;
+  // routers that get (re)started together would otherwise query the metadata
+  // servers in lockstep every TTL; shorten the first wait by a random amount
+  // of up to half the TTL to spread them out. Later waits use the full TTL so
+  // the average refresh rate does not change.
+  bool first_wait = true;
   while (!terminated_) {
     bool refresh_ok{false};
     try {
@@ -171,6 +177,14 @@ void MetadataCache::refresh_thread() {
     }
 
     auto ttl_left = ttl_;
+    if (first_wait) {
+      first_wait = false;
+      std::random_device rd;
+      std::mt19937 gen(rd());
+      std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(
+          0, ttl_.count() / 2);
+      ttl_left -= std::chrono::milliseconds(jitter(gen));
+    }
     // wait for up to TTL until next refresh, unless some replicaset loses an
     // online (primary or secondary) server - in that case, "emergency mode" is
     // enabled and we refresh every 1s until "emergency mode" is called off.
@@ -1239,26 +1239,39 @@ static uchar *compress_packet(NET *net, const uchar *packet, size_t *length) {
   uchar *compr_packet;
   size_t compr_length = 0;
   const uint header_length = NET_HEADER_SIZE + COMP_HEADER_SIZE;
+  size_t payload_length = *length;
+  uchar *compr_payload = nullptr;
 
-  compr_packet = (uchar *)my_malloc(key_memory_NET_compress_packet,
-                                    *length + header_length, MYF(MY_WME));
-
-  if (compr_packet == nullptr) return nullptr;
-
-  memcpy(compr_packet + header_length, packet, *length);
-
-  mysql_compress_context *compress_ctx = compress_context(net);
-
-  /* Compress the encapsulated packet. */
-  if (my_compress(compress_ctx, compr_packet + header_length, length,
-                  &compr_length)) {
+  /*
+    Compress straight from the caller's buffer, so that the payload is
+    copied into the packet once, compressed or not.
+  */
+  if (payload_length >= MIN_COMPRESS_LENGTH)
+    compr_payload = my_compress_alloc(compress_context(net), packet,
+                                      &payload_length, &compr_length);
+  if (compr_payload == nullptr) {
     /*
-      If the length of the compressed packet is larger than the
-      original packet, the original packet is sent uncompressed.
+      If compression failed, or the compressed packet would be larger
+      than the original packet, the original packet is sent uncompressed.
     */
     compr_length = 0;
+    payload_length = *length;
+  }
+
+  compr_packet = (uchar *)my_malloc(key_memory_NET_compress_packet,
+                                    payload_length + header_length,
+                                    MYF(MY_WME));
+
+  if (compr_packet == nullptr) {
+    my_free(compr_payload);
+    return nullptr;
   }
 
+  memcpy(compr_packet + header_length,
+         compr_payload != nullptr ? compr_payload : packet, payload_length);
+  my_free(compr_payload);
+  *length = payload_length;
+
   /* Length of the compressed (original) packet. */
   int3store(&compr_packet[NET_HEADER_SIZE], static_cast<uint>(compr_length));
   /* Length of this packet. */
@@ -31,19 +31,27 @@
 
 #include <sys/types.h>
 
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "map_helpers.h"
 #include "mem_root_deque.h"
 #include "my_alloc.h"
 #include "my_base.h"
 #include "my_inttypes.h"
+#include "my_thread.h"
+#include "mysql/psi/mysql_cond.h"
+#include "mysql/psi/mysql_mutex.h"
 #include "sql/mem_root_array.h"
+#include "sql/record_buffer.h"
 #include "sql/row_iterator.h"
 #include "sql/sql_list.h"
 
 class Filesort_info;
 class Item;
+class JOIN;
 class QUICK_SELECT_I;
 class Sort_result;
 class THD;
@@ -71,9 +79,117 @@ class TableScanIterator final : public TableRowIterator {
   int Read() override;
 
  private:
+  /**
+    Whether rows can be fetched in batches with handler::ha_rnd_next_batch()
+    instead of one ha_rnd_next() call per row; see table_scan_batch_rows.
+   */
+  bool UseBatches() const;
+
+  /// Read() when fetching batches.
+  int ReadFromBatch();
+
   uchar *const m_record;
   const double m_expected_rows;
   ha_rows *const m_examined_rows;
+
+  /// Rows fetched by the last ha_rnd_next_batch(), empty if not batching.
+  Record_buffer m_batch{0, 0, nullptr};
+  /// The next row of m_batch to return.
+  ha_rows m_batch_pos{0};
+  /// The error which ended the last batch, returned once it is consumed.
+  int m_batch_error{0};
+};
+
+/**
+  Scan a table from beginning to end using the parallel scan interface of
+  the storage engine (handler::parallel_scan_init(), parallel_scan() and
+  parallel_scan_end()).
+
+  The engine partitions the table and reads it with several threads; each
+  thread hands over batches of rows in record format, which are queued
+  here and returned one by one in record[0] by Read(). The engine scan
+  runs in a helper thread that is started by Init() and stopped by the
+  destructor, so that the executor can consume rows while they are read.
+  The helper thread scans through a clone of the table's handler, so it
+  never calls into the handler that the executor uses.
+
+  Rows come back in no particular order, and the handler cannot position()
+  on them, so the iterator is only used when IsEligible() says so.
+ */
+class ParallelTableScanIterator final : public TableRowIterator {
+ public:
+  // "examined_rows", if not nullptr, is incremented for each successful Read().
+  ParallelTableScanIterator(THD *thd, TABLE *table, ha_rows *examined_rows);
+  ~ParallelTableScanIterator() override;
+
+  /**
+    Whether a full scan of "table" in "join" can be replaced by a parallel
+    scan: parallel_table_scan is enabled, the statement is a non-locking
+    single-table SELECT that aggregates its rows, "join" is its outermost
+    query block (subqueries and derived tables may be re-initialized and
+    read outer references), and the table is an InnoDB table without BLOB
+    or generated columns (their values cannot be carried in the
+    fixed-length row batches).
+   */
+  static bool IsEligible(THD *thd, const TABLE *table, const JOIN *join);
+
+  bool Init() override;
+  int Read() override;
+
+ private:
+  /// Called by the engine threads; queues a batch of "nrows" rows.
+  bool Load(uint nrows, const void *rowdata);
+
+  /// Abort the engine scan if it is still running and wait for it to end.
+  void StopScan();
+
+  /// Body of the helper thread which runs handler::parallel_scan().
+  static void *ScanThread(void *arg);
+
+  /// Init() for a serial ha_rnd_next() scan of table()->file.
+  bool InitSerial();
+
+  /// Read() when Init() fell back to a serial scan.
+  int ReadSerial();
+
+  uchar *const m_record;
+  ha_rows *const m_examined_rows;
+
+  /// Clone of table()->file used by the engine scan, nullptr until Init().
+  handler *m_scan_file{nullptr};
+  /// true once Init() has run; a rescan falls back to a serial scan.
+  bool m_initialized{false};
+  /// Context created by parallel_scan_init(), nullptr when not scanning.
+  void *m_scan_ctx{nullptr};
+  size_t m_num_threads{0};
+  /// Length of a row in the batches, reported by the engine threads.
+  std::atomic<ulong> m_row_length{0};
+
+  my_thread_handle m_scan_thread;
+  /// true while m_scan_thread has to be joined.
+  bool m_scan_thread_started{false};
+  /// true when falling back to a serial ha_rnd_next() scan.
+  bool m_serial{false};
+  mysql_mutex_t m_mutex;
+  mysql_cond_t m_cond;
+
+  /// Batches read by the engine threads, not yet consumed. Protected by
+  /// m_mutex.
+  std::deque<std::vector<uchar>> m_batches;
+  /// true when the engine scan has ended. Protected by m_mutex.
+  bool m_scan_done{false};
+  /// true when the consumer asks the engine threads to stop. Protected by
+  /// m_mutex.
+  bool m_abort{false};
+  /// Error returned by parallel_scan(). Protected by m_mutex.
+  int m_scan_error{0};
+
+  /// The batch Read() is currently returning rows from.
+  std::vector<uchar> m_current;
+  size_t m_current_row{0};
+  size_t m_current_rows{0};
+  /// Length of the rows in m_current.
+  ulong m_current_row_length{0};
 };
 
 /** Perform a full index scan along an index. */
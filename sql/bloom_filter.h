@@ -0,0 +1,125 @@
+#ifndef SQL_BLOOM_FILTER_H_
+#define SQL_BLOOM_FILTER_H_
+
+/* Copyright (c) 2021, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  @file
+  A blocked Bloom filter over 64-bit hash values.
+*/
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+/**
+  A Bloom filter that sets kBitsPerKey bits within a single 64-bit word per
+  key, so that each insert or lookup touches a single word only. The false
+  positive rate is slightly higher than for a classic Bloom filter of the
+  same size, but lookups are a handful of instructions.
+
+  The filter does not hash the keys itself; callers pass a hash value that
+  they typically have already computed (e.g. for partitioning). The value
+  is remixed internally, so it is fine if some of its bits are correlated
+  with how the caller uses them.
+*/
+class BloomFilter {
+ public:
+  /// Approximate number of bits of filter per expected key.
+  static constexpr size_t kBitsPerExpectedKey = 8;
+  /// Number of bits set per key.
+  static constexpr int kBitsPerKey = 4;
+  /// Upper bound on the size of the filter (4 MB).
+  static constexpr size_t kMaxWords = size_t{1} << 19;
+
+  /**
+    Allocate the filter for the given number of keys and clear it. Can be
+    called again to reuse the filter.
+  */
+  void Init(size_t expected_keys) {
+    size_t words =
+        std::max<size_t>(1, expected_keys * kBitsPerExpectedKey / 64);
+    words = std::min(words, kMaxWords);
+    size_t pow2 = 1;
+    while (pow2 < words) pow2 <<= 1;
+    m_words.assign(pow2, 0);
+    m_mask = pow2 - 1;
+  }
+
+  /// Release the memory of the filter.
+  void Reset() {
+    std::vector<uint64_t>().swap(m_words);
+    m_mask = 0;
+  }
+
+  bool Initialized() const { return !m_words.empty(); }
+
+  void Insert(uint64_t hash) {
+    assert(Initialized());
+    const uint64_t mixed = Mix(hash);
+    m_words[WordIndex(mixed)] |= BitsInWord(mixed);
+  }
+
+  /**
+    @retval false the key was certainly never inserted
+    @retval true  the key may have been inserted
+  */
+  bool MayContain(uint64_t hash) const {
+    assert(Initialized());
+    const uint64_t mixed = Mix(hash);
+    const uint64_t bits = BitsInWord(mixed);
+    return (m_words[WordIndex(mixed)] & bits) == bits;
+  }
+
+ private:
+  static uint64_t Mix(uint64_t hash) {
+    // The finalizer of MurmurHash3; spreads every input bit over all
+    // output bits.
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  size_t WordIndex(uint64_t mixed) const {
+    return static_cast<size_t>(mixed >> 32) & m_mask;
+  }
+
+  static uint64_t BitsInWord(uint64_t mixed) {
+    uint64_t bits = 0;
+    for (int i = 0; i < kBitsPerKey; ++i) {
+      bits |= uint64_t{1} << ((mixed >> (6 * i)) & 63);
+    }
+    return bits;
+  }
+
+  std::vector<uint64_t> m_words;
+  size_t m_mask{0};
+};
+
+#endif  // SQL_BLOOM_FILTER_H_
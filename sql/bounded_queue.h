@@ -23,6 +23,10 @@
 #ifndef BOUNDED_QUEUE_INCLUDED
 #define BOUNDED_QUEUE_INCLUDED
 
+#include <string.h>
+#include <new>
+#include <vector>
+
 #include "my_base.h"
 #include "my_sys.h"
 #include "mysys_err.h"
@@ -60,7 +64,8 @@ class Bounded_queue {
       : m_queue(Key_compare(), alloc),
         m_sort_keys(nullptr),
         m_sort_param(nullptr),
-        m_element_size(element_size) {}
+        m_element_size(element_size),
+        m_scratch(alloc) {}
 
   /**
     Initialize the queue.
@@ -86,6 +91,12 @@ class Bounded_queue {
 
     // We allocate space for one extra element, for replace when queue is full.
     if (m_queue.reserve(max_elements + 1)) return true;
+    // New keys are made here first when the queue is full, see push().
+    try {
+      m_scratch.resize(m_element_size + 1);
+    } catch (std::bad_alloc const &) {
+      return true;
+    }
     // We cannot have packed keys in the queue.
     m_queue.m_compare_length = sort_param->max_compare_length();
     // We can have variable length keys though.
@@ -114,10 +125,18 @@ class Bounded_queue {
     const uint element_size = m_element_size + 1;
 
     if (m_queue.size() == m_queue.capacity()) {
+      /*
+        The top is the largest element we keep, so an element whose key
+        does not sort before it can never be part of the result. Make the
+        key in the scratch buffer and compare before anything else is
+        stored; make_sortkey() returns 0 for such elements.
+      */
       const Key_type &pq_top = m_queue.top();
-      const uint MY_ATTRIBUTE((unused)) rec_sz =
-          m_sort_param->make_sortkey(pq_top, element_size, opaque);
+      const uint rec_sz = m_sort_param->make_sortkey(
+          m_scratch.data(), element_size, opaque, pq_top);
       assert(rec_sz <= m_element_size);
+      if (rec_sz == 0) return;
+      memcpy(pq_top, m_scratch.data(), rec_sz);
       m_queue.update_top();
     } else {
       const uint MY_ATTRIBUTE((unused)) rec_sz = m_sort_param->make_sortkey(
@@ -137,6 +156,7 @@ class Bounded_queue {
   Key_type *m_sort_keys;
   Key_generator *m_sort_param;
   size_t m_element_size;
+  std::vector<uchar, Malloc_allocator<uchar>> m_scratch;
 };
 
 #endif  // BOUNDED_QUEUE_INCLUDED
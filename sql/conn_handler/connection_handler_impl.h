@@ -25,10 +25,15 @@
 #ifndef CONNECTION_HANDLER_IMPL_INCLUDED
 #define CONNECTION_HANDLER_IMPL_INCLUDED
 
+#include <atomic>
 #include <list>
 
+#include "my_config.h"
+#include "my_inttypes.h"
+
 #include "mysql/psi/mysql_cond.h"                 // mysql_cond_t
 #include "mysql/psi/mysql_mutex.h"                // mysql_mutex_t
+#include "mysql/psi/mysql_socket.h"               // MYSQL_SOCKET
 #include "sql/conn_handler/connection_handler.h"  // Connection_handler
 
 class Channel_info;
@@ -118,4 +123,104 @@ class One_thread_connection_handler : public Connection_handler {
   uint get_max_threads() const override { return 1; }
 };
 
+#ifdef HAVE_EPOLL
+/**
+  This class represents the connection handling functionality where
+  sessions are multiplexed onto a fixed number of thread groups.
+
+  Each group owns an epoll descriptor and a set of worker threads.
+  A worker picks the next session whose socket became readable,
+  executes one command for it and then re-arms the socket. Idle
+  workers steal queued sessions from other groups, and a timer
+  thread detects groups whose queue makes no progress (because all
+  workers are blocked) and wakes or creates an extra worker.
+  Sessions with an open transaction are served from a separate
+  high priority queue so that they release their locks early.
+*/
+class Thread_pool_connection_handler : public Connection_handler {
+  Thread_pool_connection_handler(const Thread_pool_connection_handler &);
+  Thread_pool_connection_handler &operator=(
+      const Thread_pool_connection_handler &);
+
+ public:
+  // System variables related to Thread_pool_connection_handler
+  static uint pool_size;      // Number of thread groups
+  static uint stall_limit;    // Milliseconds before a group is stalled
+  static uint max_threads;    // Upper bound on all worker threads
+  static uint idle_timeout;   // Seconds before an idle worker exits
+  static uint oversubscribe;  // Active workers allowed per group
+
+  // Status variables related to Thread_pool_connection_handler
+  static std::atomic<ulong> thread_count;
+  static std::atomic<ulong> idle_thread_count;
+  static std::atomic<ulonglong> stall_count;
+  static std::atomic<ulonglong> steal_count;
+
+  /**
+    Total number of sessions currently queued in all groups,
+    used for the Pool_of_threads_queue_depth status variable.
+  */
+  static ulong queue_depth();
+
+  /**
+    Largest number of sessions currently queued in any single group.
+  */
+  static ulong max_group_queue_depth();
+
+  /**
+    Average time in microseconds a session waited in a group queue
+    before a worker picked it up.
+  */
+  static ulonglong avg_queue_wait_usec();
+
+  /** How a thread group gets a worker for work it has queued. */
+  enum class Wakeup { NONE, SIGNAL_WORKER, CREATE_WORKER };
+
+  /**
+    Decide how a thread group gets a worker for queued work. An idle
+    worker is preferred. A new worker is only created while the group
+    runs fewer than oversubscribe active workers, or is stalled, and
+    while there are fewer than max_threads workers in total.
+
+    @param waiting  Workers of the group waiting for work.
+    @param active   Workers of the group executing a command.
+    @param stalled  true if the group made no progress recently.
+    @param total    Workers in all groups.
+  */
+  static Wakeup wakeup_action(uint waiting, uint active, bool stalled,
+                              ulong total);
+
+  /**
+    Duplicate the socket of a session for its epoll registration. The
+    duplicate refers to the same open socket, so a shutdown through any
+    descriptor is reported, but it stays registered when the Vio closes
+    its own descriptor.
+
+    @return the new descriptor, or -1 on error.
+  */
+  static int poll_descriptor(MYSQL_SOCKET socket);
+
+  /**
+    Make epoll report a session that waits for its next command, so
+    that a worker picks it up and finds it killed or timed out.
+
+    @param poll_fd  Descriptor returned by poll_descriptor().
+  */
+  static void wake_session(int poll_fd);
+
+  Thread_pool_connection_handler();
+  ~Thread_pool_connection_handler() override;
+
+  /**
+    @return true if the thread groups could not be created.
+  */
+  bool init();
+
+ protected:
+  bool add_connection(Channel_info *channel_info) override;
+
+  uint get_max_threads() const override { return max_threads; }
+};
+#endif  // HAVE_EPOLL
+
 #endif  // CONNECTION_HANDLER_IMPL_INCLUDED
@@ -155,6 +155,24 @@ bool Connection_handler_manager::init() {
     case SCHEDULER_NO_THREADS:
       connection_handler = new (std::nothrow) One_thread_connection_handler();
       break;
+    case SCHEDULER_POOL_OF_THREADS:
+#ifdef HAVE_EPOLL
+    {
+      Thread_pool_connection_handler *pool_handler =
+          new (std::nothrow) Thread_pool_connection_handler();
+      if (pool_handler != nullptr && pool_handler->init()) {
+        delete pool_handler;
+        pool_handler = nullptr;
+      }
+      connection_handler = pool_handler;
+    }
+#else
+      // The pool needs epoll, use the default handler on other platforms.
+      Connection_handler_manager::thread_handling =
+          SCHEDULER_ONE_THREAD_PER_CONNECTION;
+      connection_handler = new (std::nothrow) Per_thread_connection_handler();
+#endif
+      break;
     default:
       assert(false);
   }
@@ -142,6 +142,8 @@ void Per_thread_connection_handler::destroy() {
 
 Channel_info *Per_thread_connection_handler::block_until_new_connection() {
   Channel_info *new_conn = nullptr;
+  // Do not keep freed MEM_ROOT blocks while sitting in the thread cache.
+  flush_root_block_cache();
   mysql_mutex_lock(&LOCK_thread_cache);
   if (blocked_pthread_count < max_blocked_pthreads && !shrink_cache) {
     /* Don't kill the pthread, just block it for reuse */
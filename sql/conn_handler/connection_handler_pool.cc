@@ -0,0 +1,868 @@
+/*
+   Copyright (c) 2021, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+*/
+
+#include "my_config.h"
+
+#ifdef HAVE_EPOLL
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <algorithm>
+#include <list>
+#include <new>
+#include <thread>
+
+#include "my_dbug.h"
+#include "my_inttypes.h"
+#include "my_loglevel.h"
+#include "my_macros.h"
+#include "my_psi_config.h"
+#include "my_systime.h"
+#include "my_thread.h"
+#include "mysql/components/services/log_builtins.h"
+#include "mysql/psi/mysql_cond.h"
+#include "mysql/psi/mysql_mutex.h"
+#include "mysql/psi/mysql_socket.h"
+#include "mysql/psi/mysql_thread.h"
+#include "mysql/service_thd_wait.h"
+#include "mysql_com.h"
+#include "mysqld_error.h"  // ER_*
+#include "sql/conn_handler/channel_info.h"  // Channel_info
+#include "sql/conn_handler/connection_handler_impl.h"
+#include "sql/conn_handler/connection_handler_manager.h"  // Connection_handler_manager
+#include "sql/conn_handler/thread_pool_queue.h"  // Thread_pool_queue
+#include "sql/log.h"                                      // Error_log_throttle
+#include "sql/mysqld.h"                                   // connection_attrib
+#include "sql/mysqld_thd_manager.h"                       // Global_THD_manager
+#include "sql/protocol_classic.h"
+#include "sql/sql_class.h"    // THD
+#include "sql/sql_connect.h"  // close_connection
+#include "sql/sql_error.h"
+#include "sql/sql_parse.h"             // do_command
+#include "sql/sql_thd_internal_api.h"  // thd_set_thread_stack
+#include "violite.h"
+
+// Initialize static members
+uint Thread_pool_connection_handler::pool_size = 0;
+uint Thread_pool_connection_handler::stall_limit = 500;
+uint Thread_pool_connection_handler::max_threads = 100000;
+uint Thread_pool_connection_handler::idle_timeout = 60;
+uint Thread_pool_connection_handler::oversubscribe = 3;
+std::atomic<ulong> Thread_pool_connection_handler::thread_count{0};
+std::atomic<ulong> Thread_pool_connection_handler::idle_thread_count{0};
+std::atomic<ulonglong> Thread_pool_connection_handler::stall_count{0};
+std::atomic<ulonglong> Thread_pool_connection_handler::steal_count{0};
+
+// Error log throttle for the thread creation failure in create_worker().
+static Error_log_throttle create_worker_err_log_throttle(
+    Log_throttle ::LOG_THROTTLE_WINDOW_SIZE, ERROR_LEVEL, 0,
+    "connection_handler",
+    "Error log throttle: %10lu"
+    " 'Can't create thread to"
+    " handle new connection'"
+    " error(s) suppressed");
+
+/** Maximum number of events fetched by one epoll_wait() call. */
+static constexpr int MAX_POLL_EVENTS = 16;
+
+#ifdef HAVE_PSI_INTERFACE
+static PSI_mutex_key key_LOCK_thread_group;
+static PSI_mutex_key key_LOCK_pool_timer;
+
+static PSI_mutex_info all_pool_mutexes[] = {
+    {&key_LOCK_thread_group, "LOCK_thread_group", 0, 0, PSI_DOCUMENT_ME},
+    {&key_LOCK_pool_timer, "LOCK_pool_timer", PSI_FLAG_SINGLETON, 0,
+     PSI_DOCUMENT_ME}};
+
+static PSI_cond_key key_COND_thread_group;
+static PSI_cond_key key_COND_pool_timer;
+
+static PSI_cond_info all_pool_conds[] = {
+    {&key_COND_thread_group, "COND_thread_group", 0, 0, PSI_DOCUMENT_ME},
+    {&key_COND_pool_timer, "COND_pool_timer", PSI_FLAG_SINGLETON, 0,
+     PSI_DOCUMENT_ME}};
+
+static PSI_thread_key key_thread_pool_worker;
+static PSI_thread_key key_thread_pool_timer;
+
+static PSI_thread_info all_pool_threads[] = {
+    {&key_thread_pool_worker, "pool_worker", 0, 0, PSI_DOCUMENT_ME},
+    {&key_thread_pool_timer, "pool_timer", PSI_FLAG_SINGLETON, 0,
+     PSI_DOCUMENT_ME}};
+#endif
+
+namespace {
+
+struct Thread_group;
+
+/**
+  State of one session multiplexed by the pool. It is stored in
+  THD::scheduler.data so that the wait callbacks can find the group
+  of the session that is about to block.
+*/
+struct Pool_connection {
+  Pool_connection(THD *thd_arg, Thread_group *group_arg)
+      : thd(thd_arg), group(group_arg) {}
+
+  THD *thd;
+  Thread_group *group;
+
+  /** Instrumentation of the session, attached to whichever worker runs it. */
+  PSI_thread *psi{nullptr};
+
+  /** false until authentication has completed. */
+  bool logged_in{false};
+
+  /** true once poll_fd has been added to the epoll set of the group. */
+  bool registered{false};
+
+  /**
+    Duplicate of the session socket that is registered with epoll. A
+    KILL closes the descriptor of the Vio in THD::shutdown_active_vio(),
+    which would drop a registration made through it; this one stays, so
+    epoll still reports the shutdown. Written under thd->LOCK_thd_data.
+  */
+  int poll_fd{-1};
+
+  /** Time (microseconds) the session was put into a group queue. */
+  ulonglong queued_at{0};
+
+  /**
+    Time (microseconds) after which the idle session is disconnected,
+    0 while the session is queued or executing. Protected by the
+    mutex of the group.
+  */
+  ulonglong idle_deadline{0};
+
+  /** Position in Thread_group::connections. */
+  std::list<Pool_connection *>::iterator pos;
+};
+
+/**
+  A group of worker threads sharing one epoll descriptor and one pair
+  of run queues. All members except the atomics are protected by mutex.
+*/
+struct Thread_group {
+  mysql_mutex_t mutex;
+  mysql_cond_t cond;
+  int pollfd{-1};
+
+  /**
+    Sessions ready to execute. Sessions with an open transaction are
+    served first.
+  */
+  Thread_pool_queue<Pool_connection> queue;
+
+  /** All sessions of the group, scanned for wait_timeout. */
+  std::list<Pool_connection *> connections;
+
+  /** Number of workers belonging to the group. */
+  uint thread_count{0};
+  /** Number of workers executing a command and not blocked in a wait. */
+  uint active_thread_count{0};
+  /** Number of workers waiting on cond for work. */
+  uint waiting_thread_count{0};
+  /** true while a worker waits in epoll_wait() for the group. */
+  bool has_listener{false};
+
+  /** Number of sessions dequeued, compared by the stall detector. */
+  ulonglong dequeue_count{0};
+  ulonglong last_dequeue_count{0};
+  bool stalled{false};
+
+  /** Cumulative queue wait, exposed through status variables. */
+  std::atomic<ulonglong> queue_wait_usec{0};
+  std::atomic<ulonglong> queue_wait_count{0};
+
+  bool shutdown{false};
+};
+
+Thread_group *all_groups = nullptr;
+uint group_count = 0;
+
+mysql_mutex_t LOCK_pool_timer;
+mysql_cond_t COND_pool_timer;
+bool timer_shutdown = false;
+bool timer_running = false;
+
+bool create_worker(Thread_group *group);
+
+/**
+  Wake an idle worker of the group, or create a new one if all
+  workers are busy and the group may run more active threads.
+
+  @note Must be called with group->mutex held.
+*/
+void wake_or_create_worker(Thread_group *group) {
+  mysql_mutex_assert_owner(&group->mutex);
+  switch (Thread_pool_connection_handler::wakeup_action(
+      group->waiting_thread_count, group->active_thread_count,
+      group->stalled, Thread_pool_connection_handler::thread_count)) {
+    case Thread_pool_connection_handler::Wakeup::SIGNAL_WORKER:
+      mysql_cond_signal(&group->cond);
+      break;
+    case Thread_pool_connection_handler::Wakeup::CREATE_WORKER:
+      create_worker(group);
+      break;
+    case Thread_pool_connection_handler::Wakeup::NONE:
+      break;
+  }
+}
+
+/**
+  Put a session into the run queue of its group.
+
+  @note Must be called with group->mutex held.
+*/
+void enqueue(Thread_group *group, Pool_connection *conn) {
+  mysql_mutex_assert_owner(&group->mutex);
+  conn->queued_at = my_micro_time();
+  conn->idle_deadline = 0;
+  group->queue.push(conn, conn->thd->in_active_multi_stmt_transaction());
+}
+
+/**
+  Take the next session from the run queues of the group.
+
+  @note Must be called with group->mutex held.
+*/
+Pool_connection *dequeue(Thread_group *group) {
+  mysql_mutex_assert_owner(&group->mutex);
+  Pool_connection *conn = group->queue.pop();
+  if (conn != nullptr) {
+    group->dequeue_count++;
+    group->queue_wait_usec += my_micro_time() - conn->queued_at;
+    group->queue_wait_count++;
+  }
+  return conn;
+}
+
+/**
+  Try to take a queued session from another group. Only the low
+  priority queue is stolen from, and only from its tail, so that the
+  owner keeps serving the oldest work. Groups whose mutex is busy are
+  skipped rather than waited for.
+
+  The stolen session is moved to the group of the thief so that the
+  wait callbacks account for it correctly.
+*/
+Pool_connection *steal_from_other_groups(Thread_group *thief) {
+  const uint start = static_cast<uint>(thief - all_groups);
+  for (uint i = 1; i < group_count; i++) {
+    Thread_group *victim = &all_groups[(start + i) % group_count];
+    if (victim->queue.size() < 2) continue;
+    if (mysql_mutex_trylock(&victim->mutex) != 0) continue;
+
+    Pool_connection *conn = victim->queue.steal();
+    if (conn != nullptr) victim->connections.erase(conn->pos);
+    mysql_mutex_unlock(&victim->mutex);
+
+    if (conn != nullptr) {
+      /*
+        The epoll registration belongs to the old group. Drop it
+        here; arm_connection() adds the socket to the new group.
+      */
+      if (conn->registered) {
+        epoll_ctl(victim->pollfd, EPOLL_CTL_DEL, conn->poll_fd, nullptr);
+        conn->registered = false;
+      }
+      mysql_mutex_lock(&thief->mutex);
+      conn->group = thief;
+      thief->connections.push_front(conn);
+      conn->pos = thief->connections.begin();
+      thief->queue_wait_usec += my_micro_time() - conn->queued_at;
+      thief->queue_wait_count++;
+      thief->dequeue_count++;
+      mysql_mutex_unlock(&thief->mutex);
+      Thread_pool_connection_handler::steal_count++;
+      return conn;
+    }
+  }
+  return nullptr;
+}
+
+/**
+  Block the calling worker until a session of the group is ready.
+  One worker at a time acts as the listener and waits in epoll_wait(),
+  the others wait on the group condition.
+
+  @retval nullptr  The worker should exit (idle timeout or shutdown).
+  @retval !nullptr Session to execute a command for.
+*/
+Pool_connection *get_event(Thread_group *group) {
+  Pool_connection *conn = nullptr;
+
+  mysql_mutex_lock(&group->mutex);
+  group->active_thread_count--;
+
+  for (;;) {
+    if (group->shutdown) break;
+
+    if ((conn = dequeue(group)) != nullptr) break;
+
+    if (group_count > 1) {
+      mysql_mutex_unlock(&group->mutex);
+      conn = steal_from_other_groups(group);
+      mysql_mutex_lock(&group->mutex);
+      if (conn != nullptr) break;
+      if (group->shutdown) break;
+    }
+
+    if (!group->has_listener) {
+      epoll_event events[MAX_POLL_EVENTS];
+      group->has_listener = true;
+      mysql_mutex_unlock(&group->mutex);
+      int n = epoll_wait(group->pollfd, events, MAX_POLL_EVENTS,
+                         Thread_pool_connection_handler::stall_limit);
+      mysql_mutex_lock(&group->mutex);
+      group->has_listener = false;
+
+      for (int i = 0; i < n; i++)
+        enqueue(group, static_cast<Pool_connection *>(events[i].data.ptr));
+      /*
+        This thread takes the first session itself, let others have
+        the rest.
+      */
+      if (group->queue.size() > 1) wake_or_create_worker(group);
+      continue;
+    }
+
+    // Do not keep freed MEM_ROOT blocks while the worker is idle.
+    flush_root_block_cache();
+
+    struct timespec abstime;
+    set_timespec(&abstime, Thread_pool_connection_handler::idle_timeout);
+    group->waiting_thread_count++;
+    Thread_pool_connection_handler::idle_thread_count++;
+    int error = mysql_cond_timedwait(&group->cond, &group->mutex, &abstime);
+    group->waiting_thread_count--;
+    Thread_pool_connection_handler::idle_thread_count--;
+
+    /* Keep at least one worker per group to act as the listener. */
+    if (is_timeout(error) && group->queue.size() == 0 &&
+        group->thread_count > 1)
+      break;
+  }
+
+  if (conn != nullptr) {
+    group->active_thread_count++;
+    group->stalled = false;
+  } else {
+    group->thread_count--;
+    Thread_pool_connection_handler::thread_count--;
+    if (group->shutdown) mysql_cond_broadcast(&group->cond);
+  }
+  mysql_mutex_unlock(&group->mutex);
+  return conn;
+}
+
+/**
+  Wait for the next command of the session. If the connection layer
+  still holds data that was read ahead, the session is queued again
+  directly since epoll would not report it.
+
+  @retval true  The socket could not be armed, the session must be closed.
+*/
+bool arm_connection(Pool_connection *conn) {
+  Vio *vio = conn->thd->get_protocol_classic()->get_vio();
+  NET *net = conn->thd->get_protocol_classic()->get_net();
+  Thread_group *group = conn->group;
+
+  if ((vio->has_data != nullptr && vio->has_data(vio)) ||
+      net->remain_in_buf > 0) {
+    mysql_mutex_lock(&group->mutex);
+    enqueue(group, conn);
+    wake_or_create_worker(group);
+    mysql_mutex_unlock(&group->mutex);
+    return false;
+  }
+
+  if (conn->poll_fd < 0) {
+    mysql_mutex_lock(&conn->thd->LOCK_thd_data);
+    conn->poll_fd =
+        Thread_pool_connection_handler::poll_descriptor(vio->mysql_socket);
+    mysql_mutex_unlock(&conn->thd->LOCK_thd_data);
+    if (conn->poll_fd < 0) return true;
+  }
+
+  mysql_mutex_lock(&group->mutex);
+  conn->idle_deadline =
+      my_micro_time() + conn->thd->variables.net_wait_timeout * 1000000ULL;
+  mysql_mutex_unlock(&group->mutex);
+
+  epoll_event ev;
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  ev.data.ptr = conn;
+  int op = conn->registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+  if (epoll_ctl(group->pollfd, op, conn->poll_fd, &ev) != 0) return true;
+  conn->registered = true;
+  return false;
+}
+
+/**
+  Release all resources of a session. The THD must be attached to
+  the calling thread, it is detached and destroyed on return.
+*/
+void close_session(Pool_connection *conn) {
+  THD *thd = conn->thd;
+  Thread_group *group = conn->group;
+
+  if (conn->registered) {
+    epoll_ctl(group->pollfd, EPOLL_CTL_DEL, conn->poll_fd, nullptr);
+    conn->registered = false;
+  }
+
+  mysql_mutex_lock(&group->mutex);
+  group->connections.erase(conn->pos);
+  mysql_mutex_unlock(&group->mutex);
+
+  if (conn->poll_fd >= 0) {
+    mysql_mutex_lock(&thd->LOCK_thd_data);
+    close(conn->poll_fd);
+    conn->poll_fd = -1;
+    mysql_mutex_unlock(&thd->LOCK_thd_data);
+  }
+
+  close_connection(thd, 0, false, false);
+  thd->get_stmt_da()->reset_diagnostics_area();
+  thd->release_resources();
+
+  Global_THD_manager::get_instance()->remove_thd(thd);
+  Connection_handler_manager::dec_connection_count();
+
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  thd->set_psi(nullptr);
+  PSI_THREAD_CALL(delete_thread)(conn->psi);
+#endif
+  thd->scheduler.data = nullptr;
+  thd->restore_globals();
+  delete thd;
+  delete conn;
+}
+
+/**
+  Execute one unit of work for a session: authentication for a new
+  session, a single command otherwise.
+*/
+void handle_event(Pool_connection *conn,
+                  PSI_thread *worker_psi MY_ATTRIBUTE((unused))) {
+  THD *thd = conn->thd;
+
+  thd_set_thread_stack(thd, (char *)&thd);
+  thd->store_globals();
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread)(conn->psi);
+#endif
+  mysql_socket_set_thread_owner(
+      thd->get_protocol_classic()->get_vio()->mysql_socket);
+
+  bool close = false;
+  if (!conn->logged_in) {
+    if (thd_prepare_connection(thd)) {
+      Connection_handler_manager::get_instance()->inc_aborted_connects();
+      close = true;
+    } else {
+      conn->logged_in = true;
+    }
+  } else if (do_command(thd) || !thd_connection_alive(thd)) {
+    end_connection(thd);
+    close = true;
+  }
+
+  if (!close) {
+    /*
+      Detach before arming: as soon as the socket is armed another
+      worker may pick up the session.
+    */
+    thd->restore_globals();
+#ifdef HAVE_PSI_THREAD_INTERFACE
+    PSI_THREAD_CALL(set_thread)(worker_psi);
+#endif
+    if (!arm_connection(conn)) return;
+
+    thd_set_thread_stack(thd, (char *)&thd);
+    thd->store_globals();
+#ifdef HAVE_PSI_THREAD_INTERFACE
+    PSI_THREAD_CALL(set_thread)(conn->psi);
+#endif
+    end_connection(thd);
+  }
+
+  close_session(conn);
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  PSI_THREAD_CALL(set_thread)(worker_psi);
+#endif
+}
+
+extern "C" {
+static void *pool_worker(void *arg) {
+  Thread_group *group = static_cast<Thread_group *>(arg);
+
+  if (my_thread_init()) {
+    mysql_mutex_lock(&group->mutex);
+    group->thread_count--;
+    group->active_thread_count--;
+    Thread_pool_connection_handler::thread_count--;
+    mysql_mutex_unlock(&group->mutex);
+    my_thread_exit(nullptr);
+    return nullptr;
+  }
+
+  PSI_thread *worker_psi = nullptr;
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  worker_psi = PSI_THREAD_CALL(get_thread)();
+#endif
+
+  Pool_connection *conn;
+  while ((conn = get_event(group)) != nullptr) {
+    /*
+      The session may be stolen by this worker from another group and
+      it always comes back on the group of this worker.
+    */
+    assert(conn->group == group);
+    handle_event(conn, worker_psi);
+  }
+
+  my_thread_end();
+  my_thread_exit(nullptr);
+  return nullptr;
+}
+}  // extern "C"
+
+/**
+  Start a new worker thread for the group.
+
+  @note Must be called with group->mutex held.
+
+  @retval true  The thread could not be created.
+*/
+bool create_worker(Thread_group *group) {
+  mysql_mutex_assert_owner(&group->mutex);
+  my_thread_handle id;
+
+  group->thread_count++;
+  group->active_thread_count++;
+  Thread_pool_connection_handler::thread_count++;
+
+  int error = mysql_thread_create(key_thread_pool_worker, &id,
+                                  &connection_attrib, pool_worker, group);
+  if (error) {
+    group->thread_count--;
+    group->active_thread_count--;
+    Thread_pool_connection_handler::thread_count--;
+    connection_errors_internal++;
+    if (!create_worker_err_log_throttle.log())
+      LogErr(ERROR_LEVEL, ER_CONN_PER_THREAD_NO_THREAD, error);
+    return true;
+  }
+  Global_THD_manager::get_instance()->inc_thread_created();
+  return false;
+}
+
+/**
+  Periodic check of all groups. A group whose queue is not empty and
+  that dequeued nothing since the previous check has all its workers
+  blocked on long running statements or waits, so it is allowed to
+  run one more worker. Idle sessions that exceeded wait_timeout are
+  disconnected by shutting down their socket, which makes epoll
+  report them and the worker close them.
+*/
+void check_groups() {
+  const ulonglong now = my_micro_time();
+  for (uint i = 0; i < group_count; i++) {
+    Thread_group *group = &all_groups[i];
+    mysql_mutex_lock(&group->mutex);
+
+    if (group->queue.size() > 0 &&
+        group->dequeue_count == group->last_dequeue_count) {
+      group->stalled = true;
+      Thread_pool_connection_handler::stall_count++;
+      wake_or_create_worker(group);
+    }
+    group->last_dequeue_count = group->dequeue_count;
+
+    for (Pool_connection *conn : group->connections) {
+      if (conn->idle_deadline != 0 && conn->idle_deadline < now) {
+        conn->idle_deadline = 0;
+        Thread_pool_connection_handler::wake_session(conn->poll_fd);
+      }
+    }
+    mysql_mutex_unlock(&group->mutex);
+  }
+}
+
+extern "C" {
+static void *pool_timer(void *) {
+  my_thread_init();
+
+  mysql_mutex_lock(&LOCK_pool_timer);
+  while (!timer_shutdown) {
+    struct timespec abstime;
+    set_timespec_nsec(&abstime, Thread_pool_connection_handler::stall_limit *
+                                    1000000ULL);
+    mysql_cond_timedwait(&COND_pool_timer, &LOCK_pool_timer, &abstime);
+    if (timer_shutdown) break;
+    mysql_mutex_unlock(&LOCK_pool_timer);
+    check_groups();
+    mysql_mutex_lock(&LOCK_pool_timer);
+  }
+  timer_running = false;
+  mysql_cond_signal(&COND_pool_timer);
+  mysql_mutex_unlock(&LOCK_pool_timer);
+
+  my_thread_end();
+  my_thread_exit(nullptr);
+  return nullptr;
+}
+}  // extern "C"
+
+/**
+  Find the group of the session running on the current thread, if
+  the session is multiplexed by the pool.
+*/
+Thread_group *group_of(THD *thd) {
+  if (thd == nullptr || thd->scheduler.data == nullptr) return nullptr;
+  return static_cast<Pool_connection *>(thd->scheduler.data)->group;
+}
+
+/**
+  A worker is about to block: let another worker of the group run
+  so that queued sessions do not wait for the blocked statement.
+*/
+void pool_wait_begin(THD *thd, int) {
+  Thread_group *group = group_of(thd);
+  if (group == nullptr) return;
+  mysql_mutex_lock(&group->mutex);
+  group->active_thread_count--;
+  if (group->active_thread_count == 0 && group->queue.size() > 0)
+    wake_or_create_worker(group);
+  mysql_mutex_unlock(&group->mutex);
+}
+
+void pool_wait_end(THD *thd) {
+  Thread_group *group = group_of(thd);
+  if (group == nullptr) return;
+  mysql_mutex_lock(&group->mutex);
+  group->active_thread_count++;
+  mysql_mutex_unlock(&group->mutex);
+}
+
+/**
+  A session was killed. While it waits for its next command no worker
+  reads its socket, so the kill would only be noticed once the client
+  sends something. THD::awake() has usually shut down and closed the
+  Vio already, which epoll reports through Pool_connection::poll_fd;
+  shut that down too, for sessions whose Vio was not active. A session
+  that is queued or executing notices THD::killed by itself, and the
+  socket shutdown is harmless for it.
+
+  @note Called with thd->LOCK_thd_data held, which keeps poll_fd open.
+*/
+void pool_post_kill_notification(THD *thd) {
+  mysql_mutex_assert_owner(&thd->LOCK_thd_data);
+  if (thd == current_thd || thd->scheduler.data == nullptr) return;
+  const Pool_connection *conn =
+      static_cast<Pool_connection *>(thd->scheduler.data);
+  if (conn->poll_fd >= 0)
+    Thread_pool_connection_handler::wake_session(conn->poll_fd);
+}
+
+THD_event_functions pool_event_functions = {pool_wait_begin, pool_wait_end,
+                                            pool_post_kill_notification};
+
+}  // namespace
+
+Thread_pool_connection_handler::Thread_pool_connection_handler() {}
+
+bool Thread_pool_connection_handler::init() {
+#ifdef HAVE_PSI_INTERFACE
+  int count = static_cast<int>(array_elements(all_pool_mutexes));
+  mysql_mutex_register("sql", all_pool_mutexes, count);
+
+  count = static_cast<int>(array_elements(all_pool_conds));
+  mysql_cond_register("sql", all_pool_conds, count);
+
+  count = static_cast<int>(array_elements(all_pool_threads));
+  mysql_thread_register("sql", all_pool_threads, count);
+#endif
+
+  if (pool_size == 0)
+    pool_size = std::max(1U, std::thread::hardware_concurrency());
+
+  all_groups = new (std::nothrow) Thread_group[pool_size];
+  if (all_groups == nullptr) return true;
+  group_count = pool_size;
+
+  for (uint i = 0; i < group_count; i++) {
+    Thread_group *group = &all_groups[i];
+    mysql_mutex_init(key_LOCK_thread_group, &group->mutex, MY_MUTEX_INIT_FAST);
+    mysql_cond_init(key_COND_thread_group, &group->cond);
+    group->pollfd = epoll_create1(EPOLL_CLOEXEC);
+    if (group->pollfd < 0) return true;
+  }
+
+  mysql_mutex_init(key_LOCK_pool_timer, &LOCK_pool_timer, MY_MUTEX_INIT_FAST);
+  mysql_cond_init(key_COND_pool_timer, &COND_pool_timer);
+
+  my_thread_handle id;
+  timer_shutdown = false;
+  timer_running = true;
+  if (mysql_thread_create(key_thread_pool_timer, &id, &connection_attrib,
+                          pool_timer, nullptr)) {
+    timer_running = false;
+    return true;
+  }
+
+  Connection_handler_manager::event_functions = &pool_event_functions;
+  return false;
+}
+
+Thread_pool_connection_handler::~Thread_pool_connection_handler() {
+  if (all_groups == nullptr) return;
+
+  if (Connection_handler_manager::event_functions == &pool_event_functions)
+    Connection_handler_manager::event_functions = nullptr;
+
+  mysql_mutex_lock(&LOCK_pool_timer);
+  timer_shutdown = true;
+  mysql_cond_signal(&COND_pool_timer);
+  while (timer_running)
+    mysql_cond_wait(&COND_pool_timer, &LOCK_pool_timer);
+  mysql_mutex_unlock(&LOCK_pool_timer);
+  mysql_mutex_destroy(&LOCK_pool_timer);
+  mysql_cond_destroy(&COND_pool_timer);
+
+  /*
+    All sessions are gone at this point (see
+    Connection_handler_manager::wait_till_no_connection()), wait for
+    the workers to leave their groups.
+  */
+  for (uint i = 0; i < group_count; i++) {
+    Thread_group *group = &all_groups[i];
+    mysql_mutex_lock(&group->mutex);
+    group->shutdown = true;
+    mysql_cond_broadcast(&group->cond);
+    while (group->thread_count > 0)
+      mysql_cond_wait(&group->cond, &group->mutex);
+    mysql_mutex_unlock(&group->mutex);
+    if (group->pollfd >= 0) close(group->pollfd);
+    mysql_mutex_destroy(&group->mutex);
+    mysql_cond_destroy(&group->cond);
+  }
+
+  delete[] all_groups;
+  all_groups = nullptr;
+  group_count = 0;
+}
+
+bool Thread_pool_connection_handler::add_connection(
+    Channel_info *channel_info) {
+  Pool_connection *conn = new (std::nothrow) Pool_connection(nullptr, nullptr);
+  THD *thd = conn == nullptr ? nullptr : channel_info->create_thd();
+  if (thd == nullptr) {
+    delete conn;
+    connection_errors_internal++;
+    channel_info->send_error_and_close_channel(ER_OUT_OF_RESOURCES, 0, false);
+    Connection_handler_manager::dec_connection_count();
+    return true;
+  }
+  delete channel_info;
+
+  thd->set_new_thread_id();
+  Thread_group *group = &all_groups[thd->thread_id() % group_count];
+  conn->thd = thd;
+  conn->group = group;
+  thd->scheduler.data = conn;
+
+#ifdef HAVE_PSI_THREAD_INTERFACE
+  conn->psi = PSI_THREAD_CALL(new_thread)(key_thread_one_connection, thd,
+                                          thd->thread_id());
+  thd->set_psi(conn->psi);
+#endif
+
+  Global_THD_manager::get_instance()->add_thd(thd);
+
+  mysql_mutex_lock(&group->mutex);
+  group->connections.push_front(conn);
+  conn->pos = group->connections.begin();
+  enqueue(group, conn);
+  wake_or_create_worker(group);
+  mysql_mutex_unlock(&group->mutex);
+  return false;
+}
+
+Thread_pool_connection_handler::Wakeup
+Thread_pool_connection_handler::wakeup_action(uint waiting, uint active,
+                                              bool stalled, ulong total) {
+  if (waiting > 0) return Wakeup::SIGNAL_WORKER;
+  if (active >= oversubscribe && !stalled) return Wakeup::NONE;
+  if (total >= max_threads) return Wakeup::NONE;
+  return Wakeup::CREATE_WORKER;
+}
+
+int Thread_pool_connection_handler::poll_descriptor(MYSQL_SOCKET socket) {
+  const int fd = mysql_socket_getfd(socket);
+  if (fd < 0) return -1;
+  return fcntl(fd, F_DUPFD_CLOEXEC, 0);
+}
+
+void Thread_pool_connection_handler::wake_session(int poll_fd) {
+  /*
+    Not close(): that would silently remove the descriptor from the
+    epoll set, and nothing would ever wake the session.
+  */
+  shutdown(poll_fd, SHUT_RDWR);
+}
+
+ulong Thread_pool_connection_handler::queue_depth() {
+  ulong depth = 0;
+  for (uint i = 0; i < group_count; i++)
+    depth += all_groups[i].queue.size();
+  return depth;
+}
+
+ulong Thread_pool_connection_handler::max_group_queue_depth() {
+  ulong depth = 0;
+  for (uint i = 0; i < group_count; i++)
+    depth = std::max<ulong>(depth, all_groups[i].queue.size());
+  return depth;
+}
+
+ulonglong Thread_pool_connection_handler::avg_queue_wait_usec() {
+  ulonglong wait = 0;
+  ulonglong count = 0;
+  for (uint i = 0; i < group_count; i++) {
+    wait += all_groups[i].queue_wait_usec.load(std::memory_order_relaxed);
+    count += all_groups[i].queue_wait_count.load(std::memory_order_relaxed);
+  }
+  return count == 0 ? 0 : wait / count;
+}
+
+#endif  // HAVE_EPOLL
@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2021, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
+*/
+
+#ifndef THREAD_POOL_QUEUE_INCLUDED
+#define THREAD_POOL_QUEUE_INCLUDED
+
+#include <atomic>
+#include <deque>
+
+#include "my_inttypes.h"
+
+/**
+  Run queue of one thread group of Thread_pool_connection_handler.
+
+  Items pushed with high priority are popped before all others, items of
+  the same priority are popped in FIFO order. Other groups steal only
+  low priority items, from the tail, so that the owner keeps serving the
+  oldest work.
+
+  The queue itself is not synchronized, the caller holds the mutex of
+  the group. Only size() may be read without it.
+*/
+template <class T>
+class Thread_pool_queue {
+ public:
+  void push(T *item, bool high_priority) {
+    if (high_priority)
+      m_high.push_back(item);
+    else
+      m_low.push_back(item);
+    m_length++;
+  }
+
+  /** @return the next item to run, or nullptr if the queue is empty. */
+  T *pop() {
+    T *item = nullptr;
+    if (!m_high.empty()) {
+      item = m_high.front();
+      m_high.pop_front();
+    } else if (!m_low.empty()) {
+      item = m_low.front();
+      m_low.pop_front();
+    }
+    if (item != nullptr) m_length--;
+    return item;
+  }
+
+  /** @return the newest low priority item, or nullptr if there is none. */
+  T *steal() {
+    if (m_low.empty()) return nullptr;
+    T *item = m_low.back();
+    m_low.pop_back();
+    m_length--;
+    return item;
+  }
+
+  /** Number of queued items, readable without the mutex of the group. */
+  uint size() const { return m_length.load(std::memory_order_relaxed); }
+
+ private:
+  std::deque<T *> m_high;
+  std::deque<T *> m_low;
+  std::atomic<uint> m_length{0};
+};
+
+#endif  // THREAD_POOL_QUEUE_INCLUDED
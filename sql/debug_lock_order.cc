@@ -7861,7 +7861,7 @@ static void *lo_get_idle_interface(int version) {
 
 struct PSI_idle_bootstrap LO_idle_bootstrap = {lo_get_idle_interface};
 
-PSI_statement_service_v2 LO_statement_v2 = {
+PSI_statement_service_v3 LO_statement_v3 = {
     lo_register_statement_v2,
     lo_get_thread_statement_locker_v2,
     lo_refine_statement_v2,
@@ -7903,7 +7903,9 @@ static void *lo_get_statement_interface(int version) {
     case PSI_STATEMENT_VERSION_1:
       return nullptr;
     case PSI_STATEMENT_VERSION_2:
-      return &LO_statement_v2;
+      return nullptr;
+    case PSI_STATEMENT_VERSION_3:
+      return &LO_statement_v3;
     default:
       return nullptr;
   }
@@ -445,6 +445,7 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                            sortlength(thd, filesort->sortorder, s_length),
                            filesort->tables, max_rows,
                            filesort->m_remove_duplicates);
+  param->m_sort_threads = thd->variables.sort_threads;
 
   fs_info->addon_fields = param->addon_fields;
 
@@ -607,7 +608,8 @@ bool filesort(THD *thd, Filesort *filesort, RowIterator *source_iterator,
                                                        : "rowid");
     sort_mode.append(">");
 
-    const char *algo_text[] = {"none", "std::sort", "std::stable_sort"};
+    const char *algo_text[] = {"none", "std::sort", "std::stable_sort",
+                               "radix_sort"};
 
     Opt_trace_object filesort_summary(trace, "filesort_summary");
     filesort_summary.add("memory_available", memory_available)
@@ -1391,9 +1393,16 @@ size_t make_sortkey_from_item(Item *item, Item_result result_type,
 
 }  // namespace
 
+bool Sort_param::key_less(const uchar *a, const uchar *b) const {
+  if (using_varlen_keys())
+    return cmp_varlen_keys(local_sortorder, use_hash, a, b);
+  return memcmp(a, b, max_compare_length()) < 0;
+}
+
 uint Sort_param::make_sortkey(Bounds_checked_array<uchar> dst,
                               const Mem_root_array<TABLE *> &tables,
-                              size_t *longest_addon_so_far) {
+                              size_t *longest_addon_so_far,
+                              const uchar *threshold) {
   uchar *to = dst.array();
   uchar *to_end = dst.array() + dst.size();
   uchar *orig_to = to;
@@ -1472,6 +1481,9 @@ uint Sort_param::make_sortkey(Bounds_checked_array<uchar> dst,
   }
 
   if (using_addon_fields()) {
+    // Don't spend time on the addons of a row that will be thrown away.
+    if (threshold != nullptr && !key_less(orig_to, threshold)) return 0;
+
     /*
       Save field values appended to sorted fields.
       First null bit indicators are appended then field values follow.
@@ -1548,6 +1560,8 @@ uint Sort_param::make_sortkey(Bounds_checked_array<uchar> dst,
       memcpy(to, table->file->ref, table->file->ref_length);
       to += table->file->ref_length;
     }
+    // The row IDs are part of the compared key.
+    if (threshold != nullptr && !key_less(orig_to, threshold)) return 0;
   }
   return to - orig_to;
 }
@@ -24,12 +24,16 @@
 
 #include <string.h>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 #include "add_with_saturate.h"
 #include "my_dbug.h"
 #include "my_io.h"
 #include "my_pointer_arithmetic.h"
+#include "my_sys.h"
+#include "my_thread.h"
+#include "mysql/psi/mysql_thread.h"
 #include "sql/cmp_varlen_keys.h"
 #include "sql/opt_costmodel.h"
 #include "sql/sort_param.h"
@@ -37,6 +41,9 @@
 #include "sql/thr_malloc.h"
 
 PSI_memory_key key_memory_Filesort_buffer_sort_keys;
+PSI_thread_key key_thread_filesort;
+
+ulong max_sort_threads = 8;
 
 using std::max;
 using std::min;
@@ -46,6 +53,20 @@ using std::stable_sort;
 using std::unique;
 using std::vector;
 
+/// Smallest number of rows handed to each thread by parallel_sort().
+static constexpr size_t PARALLEL_SORT_MIN_CHUNK_ROWS = 32768;
+
+/// Buffers with fewer rows than this are sorted with std::stable_sort
+/// rather than radix_sort_keys().
+static constexpr size_t RADIX_SORT_MIN_ROWS = 4096;
+
+/// Buckets with fewer rows than this are finished with std::stable_sort.
+static constexpr size_t RADIX_SORT_MIN_BUCKET_ROWS = 64;
+
+/// Number of times radix_sort_keys() distributes a bucket before handing the
+/// remaining bytes to std::stable_sort. Bounds the recursion depth.
+static constexpr size_t RADIX_SORT_MAX_PASSES = 8;
+
 namespace {
 
 /*
@@ -135,6 +156,209 @@ class Equality_from_less {
   const Comp &m_comp;
 };
 
+/**
+  Sort keys[0 .. num_keys) on the bytes [depth, key_len), assuming they are
+  equal on all bytes before depth. tmp has room for num_keys pointers, and
+  pass is the number of distributions done on the way to this bucket.
+*/
+void radix_sort_pass(uchar **keys, uchar **tmp, size_t num_keys,
+                     size_t depth, size_t key_len, size_t pass) {
+  // Skip bytes that all keys in this bucket have in common.
+  size_t counts[256];
+  for (;; ++depth) {
+    if (depth == key_len) return;
+    if (num_keys < RADIX_SORT_MIN_BUCKET_ROWS ||
+        pass >= RADIX_SORT_MAX_PASSES) {
+      const size_t len = key_len - depth;
+      stable_sort(keys, keys + num_keys,
+                  [depth, len](const uchar *s1, const uchar *s2) {
+                    return memcmp(s1 + depth, s2 + depth, len) < 0;
+                  });
+      return;
+    }
+    std::fill(counts, counts + 256, 0);
+    for (size_t i = 0; i < num_keys; ++i) ++counts[keys[i][depth]];
+    if (counts[keys[0][depth]] != num_keys) break;
+  }
+
+  // Turn the counts into the start of each bucket, and distribute on byte
+  // "depth". This keeps the order within each bucket, so the sort is stable.
+  // Afterwards, counts[b] is the end of bucket b.
+  size_t offset = 0;
+  for (size_t b = 0; b < 256; ++b) {
+    const size_t count = counts[b];
+    counts[b] = offset;
+    offset += count;
+  }
+  for (size_t i = 0; i < num_keys; ++i) {
+    tmp[counts[keys[i][depth]]++] = keys[i];
+  }
+  memcpy(keys, tmp, num_keys * sizeof(*keys));
+
+  size_t start = 0;
+  for (size_t b = 0; b < 256; ++b) {
+    if (counts[b] - start > 1)
+      radix_sort_pass(keys + start, tmp + start, counts[b] - start, depth + 1,
+                      key_len, pass + 1);
+    start = counts[b];
+  }
+}
+
+/// Number of helper threads currently running sorts, over all sessions.
+std::atomic<ulong> sort_threads_in_use{0};
+
+/**
+  Reserves up to wanted helper threads within max_sort_threads, and gives
+  them back when it goes out of scope.
+*/
+class Sort_thread_reservation {
+ public:
+  explicit Sort_thread_reservation(size_t wanted) {
+    ulong in_use = sort_threads_in_use.load();
+    do {
+      const ulong limit = max_sort_threads;
+      m_granted = in_use >= limit ? 0 : min<ulong>(wanted, limit - in_use);
+      if (m_granted == 0) return;
+    } while (!sort_threads_in_use.compare_exchange_weak(in_use,
+                                                        in_use + m_granted));
+  }
+  ~Sort_thread_reservation() {
+    if (m_granted > 0) sort_threads_in_use.fetch_sub(m_granted);
+  }
+  size_t granted() const { return m_granted; }
+
+ private:
+  size_t m_granted;
+};
+
+/// What a helper thread of run_in_parallel() runs.
+template <class Task>
+struct Sort_thread {
+  const Task *task;
+  size_t index;
+  my_thread_handle handle;
+  bool started{false};
+};
+
+template <class Task>
+void *sort_thread_main(void *arg) {
+  my_thread_init();
+  Sort_thread<Task> *thread = static_cast<Sort_thread<Task> *>(arg);
+  (*thread->task)(thread->index);
+  my_thread_end();
+  return nullptr;
+}
+
+/**
+  Run task(0) .. task(n_tasks - 1) concurrently, task(0) in the calling
+  thread. The caller must have reserved n_tasks - 1 helper threads. If a
+  thread cannot be created, its task runs in the caller instead.
+*/
+template <class Task>
+void run_in_parallel(size_t n_tasks, const Task &task) {
+  vector<Sort_thread<Task>> threads(n_tasks);
+  for (size_t i = 1; i < n_tasks; ++i) {
+    threads[i].task = &task;
+    threads[i].index = i;
+    if (mysql_thread_create(key_thread_filesort, &threads[i].handle, nullptr,
+                            sort_thread_main<Task>, &threads[i]))
+      task(i);
+    else
+      threads[i].started = true;
+  }
+  task(0);
+  for (Sort_thread<Task> &thread : threads) {
+    if (thread.started) my_thread_join(&thread.handle, nullptr);
+  }
+}
+
+/**
+  Sort [first, last) according to comp using up to max_threads threads,
+  the calling thread included. Helper threads are only used as far as
+  max_sort_threads allows. sort_chunk(chunk_first, chunk_last) must sort a
+  subrange according to comp.
+
+  The range is cut into equally sized chunks which are sorted concurrently.
+  Neighbouring chunks are then merged pairwise, each round of merges also
+  running concurrently, until a single sorted range remains. Since
+  std::inplace_merge is stable and always merges a chunk with the one
+  directly after it, the result is stable if sort_chunk is.
+*/
+template <class Iterator, class Comp, class Sort_chunk>
+void parallel_sort(Iterator first, Iterator last, const Comp &comp,
+                   const Sort_chunk &sort_chunk, size_t max_threads) {
+  const size_t num_rows = last - first;
+  const size_t wanted_chunks =
+      min<size_t>(max_threads, num_rows / PARALLEL_SORT_MIN_CHUNK_ROWS);
+
+  if (wanted_chunks <= 1) {
+    sort_chunk(first, last);
+    return;
+  }
+
+  const Sort_thread_reservation reservation(wanted_chunks - 1);
+  const size_t num_chunks = reservation.granted() + 1;
+  if (num_chunks <= 1) {
+    sort_chunk(first, last);
+    return;
+  }
+
+  // bounds[i] is the start of chunk i, bounds[num_chunks] is the end.
+  vector<Iterator> bounds;
+  bounds.reserve(num_chunks + 1);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    bounds.push_back(first + i * (num_rows / num_chunks));
+  }
+  bounds.push_back(last);
+
+  run_in_parallel(num_chunks, [&bounds, &sort_chunk](size_t i) {
+    sort_chunk(bounds[i], bounds[i + 1]);
+  });
+
+  while (bounds.size() > 2) {
+    const size_t num_merges = (bounds.size() - 1) / 2;
+    run_in_parallel(num_merges, [&bounds, &comp](size_t i) {
+      std::inplace_merge(bounds[2 * i], bounds[2 * i + 1], bounds[2 * i + 2],
+                         comp);
+    });
+    // Drop the boundaries between the chunks that were just merged.
+    vector<Iterator> merged;
+    merged.reserve(bounds.size() / 2 + 1);
+    for (size_t i = 0; i < bounds.size(); i += 2) merged.push_back(bounds[i]);
+    if (merged.back() != last) merged.push_back(last);
+    bounds.swap(merged);
+  }
+}
+
+/**
+  Stable sort of [first, last) on up to param->m_sort_threads threads. Large
+  buffers are radix sorted, since fixed-length keys compare byte-by-byte.
+*/
+template <class Comp>
+void stable_sort_fixed_keys(vector<uchar *>::iterator first,
+                            vector<uchar *>::iterator last, const Comp &comp,
+                            size_t key_len, Sort_param *param) {
+  const size_t max_threads = param->m_sort_threads;
+  if (static_cast<size_t>(last - first) < RADIX_SORT_MIN_ROWS) {
+    parallel_sort(first, last, comp,
+                  [&comp](vector<uchar *>::iterator chunk_first,
+                          vector<uchar *>::iterator chunk_last) {
+                    stable_sort(chunk_first, chunk_last, comp);
+                  },
+                  max_threads);
+    return;
+  }
+  param->m_sort_algorithm = Sort_param::FILESORT_ALG_RADIX;
+  parallel_sort(first, last, comp,
+                [key_len](vector<uchar *>::iterator chunk_first,
+                          vector<uchar *>::iterator chunk_last) {
+                  radix_sort_keys(&*chunk_first,
+                                  &*chunk_first + (chunk_last - chunk_first),
+                                  key_len);
+                },
+                max_threads);
+}
+
 }  // namespace
 
 size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
@@ -166,12 +390,22 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
     }
     if (force_stable_sort) {
       param->m_sort_algorithm = Sort_param::FILESORT_ALG_STD_STABLE;
-      stable_sort(it_begin, it_end, comp);
+      parallel_sort(it_begin, it_end, comp,
+                    [&comp](vector<uchar *>::iterator first,
+                            vector<uchar *>::iterator last) {
+                      stable_sort(first, last, comp);
+                    },
+                    param->m_sort_threads);
     } else {
       // TODO: Make more elaborate heuristics than just always picking
       // std::sort.
       param->m_sort_algorithm = Sort_param::FILESORT_ALG_STD_SORT;
-      sort(it_begin, it_end, comp);
+      parallel_sort(it_begin, it_end, comp,
+                    [&comp](vector<uchar *>::iterator first,
+                            vector<uchar *>::iterator last) {
+                      sort(first, last, comp);
+                    },
+                    param->m_sort_threads);
     }
     if (param->m_remove_duplicates) {
       num_input_rows =
@@ -238,7 +472,8 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                   Mem_compare(key_len));
       it_end = it_begin + max_output_rows;
     }
-    stable_sort(it_begin, it_end, Mem_compare(key_len));
+    stable_sort_fixed_keys(it_begin, it_end, Mem_compare(key_len), key_len,
+                           param);
     if (param->m_remove_duplicates) {
       num_input_rows =
           unique(it_begin, it_end,
@@ -251,7 +486,8 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
                   Mem_compare_longkey(key_len));
       it_end = it_begin + max_output_rows;
     }
-    stable_sort(it_begin, it_end, Mem_compare_longkey(key_len));
+    stable_sort_fixed_keys(it_begin, it_end, Mem_compare_longkey(key_len),
+                           key_len, param);
     if (param->m_remove_duplicates) {
       num_input_rows = unique(it_begin, it_end,
                               Equality_from_less<Mem_compare_longkey>(
@@ -262,6 +498,28 @@ size_t Filesort_buffer::sort_buffer(Sort_param *param, size_t num_input_rows,
   return std::min(num_input_rows, max_output_rows);
 }
 
+void radix_sort_keys(uchar **first, uchar **last, size_t key_len) {
+  const size_t num_keys = last - first;
+  if (num_keys < RADIX_SORT_MIN_ROWS) {
+    stable_sort(first, last, [key_len](const uchar *s1, const uchar *s2) {
+      return memcmp(s1, s2, key_len) < 0;
+    });
+    return;
+  }
+  // The scratch array is as large as the key pointers themselves; if we
+  // cannot get it, sort without it.
+  unique_ptr_my_free<uchar *[]> tmp(static_cast<uchar **>(
+      my_malloc(key_memory_Filesort_buffer_sort_keys,
+                num_keys * sizeof(uchar *), MYF(0))));
+  if (tmp == nullptr) {
+    stable_sort(first, last, [key_len](const uchar *s1, const uchar *s2) {
+      return memcmp(s1, s2, key_len) < 0;
+    });
+    return;
+  }
+  radix_sort_pass(first, tmp.get(), num_keys, 0, key_len, 0);
+}
+
 void Filesort_buffer::reset() {
   update_peak_memory_used();
   m_record_pointers.clear();
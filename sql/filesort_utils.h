@@ -34,12 +34,22 @@
 #include "my_base.h"  // ha_rows
 
 #include "my_inttypes.h"
-#include "mysql/service_mysql_alloc.h"  // my_free
+#include "mysql/components/services/psi_thread_bits.h"  // PSI_thread_key
+#include "mysql/service_mysql_alloc.h"                   // my_free
 #include "sql/sql_array.h"              // Bounds_checked_array
 
 class Cost_model_table;
 class Sort_param;
 
+extern PSI_thread_key key_thread_filesort;
+
+/**
+  Maximum number of helper threads that all sessions together may use for
+  sorting in-memory buffers (the global max_sort_threads). A sort that
+  finds them all in use gets fewer threads, down to only its own.
+*/
+extern ulong max_sort_threads;
+
 /**
   Buffer used for storing records to be sorted. The records are stored in
   a series of buffers that are allocated incrementally, growing 50% each
@@ -283,4 +293,19 @@ class Filesort_buffer {
   Filesort_buffer &operator=(Filesort_buffer &&rhs) = default;
 };
 
+/**
+  Stable MSD radix sort of an array of pointers to keys that compare
+  byte-by-byte, like the normalized fixed-length keys make_sortkey() writes.
+  The keys are distributed on one byte at a time; buckets that become small,
+  and keys that share a long common prefix, are finished with
+  std::stable_sort on the remaining bytes. The scratch array of key pointers
+  is allocated with my_malloc() under key_memory_Filesort_buffer_sort_keys;
+  if that fails, the whole range is sorted with std::stable_sort instead.
+
+  @param first    First key pointer.
+  @param last     One past the last key pointer.
+  @param key_len  Number of bytes of each key to sort on.
+*/
+void radix_sort_keys(uchar **first, uchar **last, size_t key_len);
+
 #endif  // FILESORT_UTILS_INCLUDED
@@ -2992,6 +2992,50 @@ int handler::ha_rnd_next(uchar *buf) {
   return result;
 }
 
+/**
+  Read a batch of rows via random scan.
+
+  The rows are appended to the batch in the same format as ha_rnd_next()
+  would return them. Generated columns are not computed, so this must not
+  be used on tables which have them.
+
+  @param[in,out] batch  Buffer to read the rows into
+
+  @return Operation status
+    @retval 0     The batch is full
+    @retval != 0  Error which ended the batch. The rows in the batch are
+                  still valid.
+*/
+
+int handler::ha_rnd_next_batch(Record_buffer *batch) {
+  int result;
+  DBUG_TRACE;
+  assert(table_share->tmp_table != NO_TMP_TABLE || m_lock_type != F_UNLCK);
+  assert(inited == RND);
+  assert(!table->has_gcol());
+  assert(batch->record_size() >= table->s->reclength);
+
+  batch->clear();
+  MYSQL_TABLE_IO_WAIT(PSI_TABLE_FETCH_ROW, MAX_KEY, result,
+                      { result = rnd_next_batch(batch); })
+  table->set_row_status_from_handler(batch->records() > 0 ? 0 : result);
+  return result;
+}
+
+int handler::rnd_next_batch(Record_buffer *batch) {
+  while (batch->records() < batch->max_records()) {
+    uchar *buf = batch->add_record();
+    const int error = rnd_next(buf);
+    if (error != 0) {
+      batch->remove_last();
+      // Deleted rows of a concurrent scan are skipped, as in rnd_next().
+      if (error == HA_ERR_RECORD_DELETED) continue;
+      return error;
+    }
+  }
+  return 0;
+}
+
 /**
   Read row via random scan from position.
 
@@ -6710,6 +6754,9 @@ int DsMrr_impl::dsmrr_fill_buffer() {
       [this](const uchar *a, const uchar *b) { return h->cmp_ref(a, b) < 0; });
   rowids_buf_last = rowids_buf_cur;
   rowids_buf_cur = rowids_buf;
+
+  /* Let the engine start reading the rows we are about to fetch. */
+  h->read_ahead_positions(rowids_buf, rowids_buf_last, elem_size);
   return 0;
 }
 
@@ -514,6 +514,13 @@ enum enum_alter_inplace_result {
 */
 #define HA_MULTI_VALUED_KEY_SUPPORT (1LL << 55)
 
+/**
+  The handler implements rnd_next_batch() itself, rather than through the
+  default one rnd_next() call per row. Table scans only fetch batches from
+  such handlers.
+*/
+#define HA_RND_NEXT_BATCH (1LL << 56)
+
 /*
   Bits in index_flags(index_number) for what you can do with index.
   If you do not implement indexes, just return zero here.
@@ -4444,6 +4451,7 @@ class handler {
   int ha_rnd_init(bool scan);
   int ha_rnd_end();
   int ha_rnd_next(uchar *buf);
+  int ha_rnd_next_batch(Record_buffer *batch);
   // See the comment on m_update_generated_read_fields.
   int ha_rnd_pos(uchar *buf, uchar *pos);
   int ha_index_read_map(uchar *buf, const uchar *key, key_part_map keypart_map,
@@ -5145,6 +5153,23 @@ class handler {
  protected:
   /// @see index_read_map().
   virtual int rnd_next(uchar *buf) = 0;
+  /**
+    Read the next rows of a table scan into a batch. Rows are appended
+    with Record_buffer::add_record() until the batch is full or the read
+    fails. Each record has the same format as the buffer passed to
+    rnd_next().
+
+    The default implementation calls rnd_next() once per row. Engines may
+    override it to produce the whole batch in one call, and then announce
+    it with HA_RND_NEXT_BATCH.
+
+    @param batch  Buffer to read the rows into, empty on entry.
+
+    @return 0 if the batch was filled, otherwise the error which ended
+            the batch (typically HA_ERR_END_OF_FILE). The rows already
+            in the batch are valid in both cases.
+  */
+  virtual int rnd_next_batch(Record_buffer *batch);
   /// @see index_read_map().
   virtual int rnd_pos(uchar *buf, uchar *pos) = 0;
 
@@ -5190,6 +5215,31 @@ class handler {
                                    key_range *max_key MY_ATTRIBUTE((unused))) {
     return (ha_rows)10;
   }
+
+  /**
+    Tell the storage engine how many rows the range optimizer expects the
+    next forward range scan on the active index to read, so that it can start
+    reading the pages it will need ahead of the scan. This is only a hint;
+    it applies to the next index read only and is dropped by index_end().
+
+    @param rows  Estimated number of rows in the range
+  */
+  virtual void set_range_scan_expected_rows(
+      ha_rows rows MY_ATTRIBUTE((unused))) {}
+
+  /**
+    Tell the storage engine which rows are about to be read with rnd_pos(),
+    so that it can start reading the pages they are on. Used by DS-MRR after
+    it has sorted a buffer of row references. This is only a hint.
+
+    @param first   First row reference
+    @param last    End of the row references
+    @param stride  Distance in bytes between two row references, at least
+                   ref_length
+  */
+  virtual void read_ahead_positions(const uchar *first MY_ATTRIBUTE((unused)),
+                                    const uchar *last MY_ATTRIBUTE((unused)),
+                                    size_t stride MY_ATTRIBUTE((unused))) {}
   /*
     If HA_PRIMARY_KEY_REQUIRED_FOR_POSITION is set, then it sets ref
     (reference to the row, aka position, with the primary key given in
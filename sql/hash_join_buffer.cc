@@ -23,6 +23,7 @@
 #include "sql/hash_join_buffer.h"
 
 #include <assert.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -126,7 +127,7 @@ HashJoinRowBuffer::HashJoinRowBuffer(
   m_mem_root.set_max_capacity(0);
 }
 
-bool HashJoinRowBuffer::Init() {
+bool HashJoinRowBuffer::Init(double expected_rows) {
   if (m_hash_map.get() != nullptr) {
     // Reset the unique_ptr, so that the hash map destructors are called before
     // clearing the MEM_ROOT.
@@ -151,6 +152,35 @@ bool HashJoinRowBuffer::Init() {
     return true;
   }
 
+  if (expected_rows >= 2.0) {
+    // reserve() rounds the number of buckets up to a power of two that keeps
+    // the load factor below its maximum, and StoreRow() counts the whole
+    // table against the buffer. Find the bucket count the same way, and never
+    // let the table take more than half of the buffer, so that the rest is
+    // left for the rows and keys themselves.
+    const size_t max_table_bytes = m_max_mem_available / 2;
+    size_t buckets = 0;
+    for (size_t candidate = 8;
+         m_hash_map->calcNumBytesTotal(candidate) <= max_table_bytes;
+         candidate *= 2) {
+      buckets = candidate;
+      if (m_hash_map->calcMaxNumElementsAllowed(candidate) >= expected_rows)
+        break;
+    }
+    const size_t rows_to_reserve =
+        buckets == 0 ? 0
+                     : std::min<double>(
+                           expected_rows,
+                           m_hash_map->calcMaxNumElementsAllowed(buckets));
+    if (rows_to_reserve > 0) {
+      try {
+        m_hash_map->reserve(rows_to_reserve);
+      } catch (const std::bad_alloc &) {
+        // Not fatal; the hash table will grow as rows are inserted.
+      }
+    }
+  }
+
   m_last_row_stored = LinkedImmutableString{nullptr};
   return false;
 }
@@ -204,7 +204,12 @@ class HashJoinRowBuffer {
   // Initialize the HashJoinRowBuffer so it is ready to store rows. This
   // function can be called multiple times; subsequent calls will only clear the
   // buffer for existing rows.
-  bool Init();
+  //
+  // "expected_rows" is the number of rows the caller expects to store, or zero
+  // if unknown. The hash table is sized up front for as many of them as are
+  // likely to fit in memory, so that it does not have to be rehashed (with
+  // every key moved) each time it doubles while it is being built.
+  bool Init(double expected_rows = 0.0);
 
   /// Store the row that is currently lying in the tables record buffers.
   /// The hash map key is extracted from the join conditions that the row buffer
@@ -105,8 +105,8 @@ HashJoinIterator::HashJoinIterator(
   }
 }
 
-bool HashJoinIterator::InitRowBuffer() {
-  if (m_row_buffer.Init()) {
+bool HashJoinIterator::InitRowBuffer(double expected_rows) {
+  if (m_row_buffer.Init(expected_rows)) {
     assert(thd()->is_error());  // my_error should have been called.
     return true;
   }
@@ -191,6 +191,7 @@ bool HashJoinIterator::Init() {
 
   // Close any leftover files from previous iterations.
   m_chunk_files_on_disk.clear();
+  m_build_key_filter.Reset();
 
   m_build_chunk_current_row = 0;
   m_probe_chunk_current_row = 0;
@@ -245,16 +246,26 @@ static bool ConstructJoinKey(
   return false;
 }
 
+static uint64_t HashJoinKey(const char *key, size_t length,
+                            uint32 xxhash_seed) {
+  return length == 0 ? kZeroKeyLengthHash
+                     : MY_XXH64(key, length, xxhash_seed);
+}
+
 // Write a single row to a HashJoinChunk. The row must lie in the record buffer
 // (record[0]) for each involved table. The row is put into one of the chunks in
 // the input vector "chunks"; which chunk to use is decided by the hash value of
 // the join attribute.
+//
+// If "build_key_filter" is given, build rows have their join key added to it,
+// and probe rows whose join key is rejected by it are not written at all.
 static bool WriteRowToChunk(
     THD *thd, Mem_root_array<ChunkPair> *chunks, bool write_to_build_chunk,
     const pack_rows::TableCollection &tables,
     const Prealloced_array<HashJoinCondition, 4> &join_conditions,
     const uint32 xxhash_seed, bool row_has_match,
-    bool store_row_with_null_in_join_key, String *join_key_and_row_buffer) {
+    bool store_row_with_null_in_join_key, String *join_key_and_row_buffer,
+    BloomFilter *build_key_filter) {
   assert(!thd->is_error());
   bool null_in_join_key = ConstructJoinKey(
       thd, join_conditions, tables.tables_bitmap(), join_key_and_row_buffer);
@@ -268,10 +279,18 @@ static bool WriteRowToChunk(
   }
 
   const uint64_t join_key_hash =
-      join_key_and_row_buffer->length() == 0
-          ? kZeroKeyLengthHash
-          : MY_XXH64(join_key_and_row_buffer->ptr(),
-                     join_key_and_row_buffer->length(), xxhash_seed);
+      HashJoinKey(join_key_and_row_buffer->ptr(),
+                  join_key_and_row_buffer->length(), xxhash_seed);
+
+  if (build_key_filter != nullptr) {
+    if (write_to_build_chunk) {
+      build_key_filter->Insert(join_key_hash);
+    } else if (!build_key_filter->MayContain(join_key_hash)) {
+      // The probe row cannot match any row from the build input, so there is
+      // no point in writing it to disk.
+      return false;
+    }
+  }
 
   assert((chunks->size() & (chunks->size() - 1)) == 0);
   // Since we know that the number of chunks will be a power of two, do a
@@ -295,7 +314,8 @@ static bool WriteRowsToChunks(
     const Prealloced_array<HashJoinCondition, 4> &join_conditions,
     const uint32 xxhash_seed, Mem_root_array<ChunkPair> *chunks,
     bool write_to_build_chunk, bool write_rows_with_null_in_join_key,
-    table_map tables_to_get_rowid_for, String *join_key_buffer) {
+    table_map tables_to_get_rowid_for, String *join_key_buffer,
+    BloomFilter *build_key_filter) {
   for (;;) {  // Termination condition within loop.
     int res = iterator->Read();
     if (res == 1) {
@@ -313,7 +333,8 @@ static bool WriteRowsToChunks(
     RequestRowId(tables.tables(), tables_to_get_rowid_for);
     if (WriteRowToChunk(thd, chunks, write_to_build_chunk, tables,
                         join_conditions, xxhash_seed, /*row_has_match=*/false,
-                        write_rows_with_null_in_join_key, join_key_buffer)) {
+                        write_rows_with_null_in_join_key, join_key_buffer,
+                        build_key_filter)) {
       assert(thd->is_error());  // my_error should have been called.
       return true;
     }
@@ -402,7 +423,7 @@ bool HashJoinIterator::BuildHashTable() {
                                         m_row_buffer.LastRowStored());
   }
 
-  if (InitRowBuffer()) {
+  if (InitRowBuffer(m_estimated_build_rows)) {
     return true;
   }
 
@@ -492,13 +513,24 @@ bool HashJoinIterator::BuildHashTable() {
         //
         // We never write out rows with NULL in condition for the build/right
         // input, as these rows will never match in a join condition.
+        //
+        // For inner joins and semijoins, a probe row that matches no build row
+        // produces no output, so we collect the join keys of the entire build
+        // input in a Bloom filter, and use it to avoid writing most of the
+        // non-matching probe rows to disk.
+        BloomFilter *build_key_filter = nullptr;
+        if (m_join_type == JoinType::INNER || m_join_type == JoinType::SEMI) {
+          InitBuildKeyFilter();
+          build_key_filter = &m_build_key_filter;
+        }
         if (WriteRowsToChunks(thd(), m_build_input.get(), m_build_input_tables,
                               m_join_conditions, kChunkPartitioningHashSeed,
                               &m_chunk_files_on_disk,
                               true /* write_to_build_chunks */,
                               false /* write_rows_with_null_in_join_key */,
                               m_tables_to_get_rowid_for,
-                              &m_temporary_row_and_join_key_buffer)) {
+                              &m_temporary_row_and_join_key_buffer,
+                              build_key_filter)) {
           assert(thd()->is_error() ||
                  thd()->killed);  // my_error should have been called.
           return true;
@@ -562,13 +594,15 @@ bool HashJoinIterator::ReadNextHashJoinChunk() {
     return false;
   }
 
-  if (InitRowBuffer()) {
-    return true;
-  }
-
   HashJoinChunk &build_chunk =
       m_chunk_files_on_disk[m_current_chunk].build_chunk;
 
+  // The number of rows left in the chunk is exact, so the hash table can be
+  // sized for all of them (memory permitting) before reading them back.
+  if (InitRowBuffer(build_chunk.num_rows() - m_build_chunk_current_row)) {
+    return true;
+  }
+
   const bool reject_duplicate_keys = RejectDuplicateKeys();
   const bool store_rows_with_null_in_join_key = m_join_type == JoinType::OUTER;
   for (; m_build_chunk_current_row < build_chunk.num_rows();
@@ -871,6 +905,18 @@ int HashJoinIterator::ReadJoinedRow() {
   return 0;
 }
 
+void HashJoinIterator::InitBuildKeyFilter() {
+  // The chunk files are not written yet, so the estimate from the planner is
+  // all we have for sizing the filter.
+  m_build_key_filter.Init(std::max<size_t>(
+      m_row_buffer.size(), static_cast<size_t>(m_estimated_build_rows)));
+  for (const auto &key_and_row : m_row_buffer) {
+    const ImmutableStringWithLength::Decoded key = key_and_row.first.Decode();
+    m_build_key_filter.Insert(
+        HashJoinKey(key.data, key.size, kChunkPartitioningHashSeed));
+  }
+}
+
 bool HashJoinIterator::WriteProbeRowToDiskIfApplicable() {
   // If we are spilling to disk, we need to match the row against rows from
   // the build input that are written out to chunk files. So we need to write
@@ -891,7 +937,10 @@ bool HashJoinIterator::WriteProbeRowToDiskIfApplicable() {
                             m_probe_input_tables, m_join_conditions,
                             kChunkPartitioningHashSeed, found_match,
                             write_rows_with_null_in_join_key,
-                            &m_temporary_row_and_join_key_buffer)) {
+                            &m_temporary_row_and_join_key_buffer,
+                            m_build_key_filter.Initialized()
+                                ? &m_build_key_filter
+                                : nullptr)) {
           return true;
         }
       }
@@ -32,6 +32,7 @@
 #include "my_base.h"
 #include "my_table_map.h"
 #include "prealloced_array.h"
+#include "sql/bloom_filter.h"
 #include "sql/hash_join_buffer.h"
 #include "sql/hash_join_chunk.h"
 #include "sql/immutable_string.h"
@@ -399,6 +400,11 @@ class HashJoinIterator final : public RowIterator {
   // Have we degraded into on-disk hash join?
   bool on_disk_hash_join() const { return !m_chunk_files_on_disk.empty(); }
 
+  /// Size the Bloom filter over the join keys of the build input, and add the
+  /// keys of the rows that are already in the hash table. The keys of the
+  /// remaining build rows are added as they are written to chunk files.
+  void InitBuildKeyFilter();
+
   /// Write the last row read from the probe input out to chunk files on disk,
   /// if applicable.
   ///
@@ -409,6 +415,9 @@ class HashJoinIterator final : public RowIterator {
   /// matching row in the hash table could cause the row to be returned multiple
   /// times.
   ///
+  /// Probe rows that are rejected by the build key filter (if any) cannot
+  /// match any build row, and are never written out.
+  ///
   /// @retval true in case of errors.
   bool WriteProbeRowToDiskIfApplicable();
 
@@ -431,8 +440,11 @@ class HashJoinIterator final : public RowIterator {
   /// Clear the row buffer and reset all iterators pointing to it. This may be
   /// called multiple times to re-init the row buffer.
   ///
+  /// @param expected_rows the number of rows expected to be stored in the row
+  ///   buffer, used for sizing its hash table. Zero if unknown.
+  ///
   /// @retval true in case of error. my_error has been called
-  bool InitRowBuffer();
+  bool InitRowBuffer(double expected_rows);
 
   /// Prepare to read the probe iterator from the beginning, and enable batch
   /// mode if applicable. The iterator state will remain unchanged.
@@ -521,6 +533,11 @@ class HashJoinIterator final : public RowIterator {
   // on-disk hash join.
   Mem_root_array<ChunkPair> m_chunk_files_on_disk;
 
+  // The join keys of all rows from the build input, for on-disk inner joins
+  // and semijoins. Only initialized while the build input is spilled to disk;
+  // see InitBuildKeyFilter().
+  BloomFilter m_build_key_filter;
+
   // Which HashJoinChunk, if any, we are currently reading from, in both
   // LOADING_NEXT_CHUNK_PAIR and READING_ROW_FROM_PROBE_CHUNK_FILE.
   // It is incremented during the state LOADING_NEXT_CHUNK_PAIR.
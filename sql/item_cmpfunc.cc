@@ -4307,9 +4307,63 @@ class Cmp_longlong {
   }
 };
 
+/// Lists at least this long are looked up through a hash set.
+static constexpr uint IN_HASH_MIN_ELEMENTS = 64;
+
+static constexpr uchar IN_HASH_SIGNED = 1;
+static constexpr uchar IN_HASH_UNSIGNED = 2;
+
+static inline size_t hash_in_longlong(longlong val) {
+  ulonglong h = static_cast<ulonglong>(val);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return static_cast<size_t>(h);
+}
+
 void in_longlong::resize_and_sort() {
   base.resize(used_count);
   std::sort(base.begin(), base.end(), Cmp_longlong());
+  build_hash();
+}
+
+void in_longlong::build_hash() {
+  m_hash.clear();
+  if (used_count < IN_HASH_MIN_ELEMENTS) return;
+
+  size_t n_slots = 1;
+  while (n_slots < 2 * size_t{used_count}) n_slots <<= 1;
+  m_hash.resize(n_slots, hash_slot{0, 0});
+  if (m_hash.size() != n_slots) {
+    // Out of memory; binary search works without the hash.
+    m_hash.clear();
+    return;
+  }
+
+  const size_t mask = n_slots - 1;
+  for (const packed_longlong &value : base) {
+    size_t i = hash_in_longlong(value.val) & mask;
+    while (m_hash[i].flags != 0 && m_hash[i].val != value.val)
+      i = (i + 1) & mask;
+    m_hash[i].val = value.val;
+    m_hash[i].flags |= value.unsigned_flag ? IN_HASH_UNSIGNED : IN_HASH_SIGNED;
+  }
+}
+
+/**
+  Hash equivalent of binary search with cmp_longlong(): the bit patterns
+  must be equal, and if the signedness differs, the value must fit in the
+  positive signed range.
+*/
+bool in_longlong::hash_contains(const packed_longlong &value) const {
+  const size_t mask = m_hash.size() - 1;
+  for (size_t i = hash_in_longlong(value.val) & mask; m_hash[i].flags != 0;
+       i = (i + 1) & mask) {
+    if (m_hash[i].val != value.val) continue;
+    const uchar flag = value.unsigned_flag ? IN_HASH_UNSIGNED : IN_HASH_SIGNED;
+    return (m_hash[i].flags & flag) != 0 || value.val >= 0;
+  }
+  return false;
 }
 
 bool in_longlong::find_item(Item *item) {
@@ -4317,6 +4371,7 @@ bool in_longlong::find_item(Item *item) {
   packed_longlong result;
   val_item(item, &result);
   if (item->null_value) return false;
+  if (!m_hash.empty()) return hash_contains(result);
   return std::binary_search(base.begin(), base.end(), result, Cmp_longlong());
 }
 
@@ -1613,7 +1613,7 @@ class in_longlong : public in_vector {
 
  public:
   in_longlong(MEM_ROOT *mem_root, uint elements)
-      : in_vector(elements), base(mem_root, elements) {}
+      : in_vector(elements), base(mem_root, elements), m_hash(mem_root) {}
   Item_basic_constant *create_item(MEM_ROOT *mem_root) const override {
     /*
       We've created a signed INT, this may not be correct in the
@@ -1629,8 +1629,26 @@ class in_longlong : public in_vector {
   bool compare_elems(uint pos1, uint pos2) const override;
 
  private:
+  /**
+    Slot in the hash set over the values in base. flags tells whether val
+    occurs as a signed value, an unsigned value or both; 0 means empty.
+  */
+  struct hash_slot {
+    longlong val;
+    uchar flags;
+  };
+
+  /**
+    Open-addressing hash set, built for long lists so that find_item()
+    does not binary search thousands of values for every row. Empty if the
+    list is short; base stays sorted in any case.
+  */
+  Mem_root_array<hash_slot> m_hash;
+
   void set(uint pos, Item *item) override { val_item(item, &base[pos]); }
   void resize_and_sort() override;
+  void build_hash();
+  bool hash_contains(const packed_longlong &value) const;
   virtual void val_item(Item *item, packed_longlong *result);
 };
 
@@ -5418,6 +5418,43 @@ double Item_func_st_hausdorff_distance::val_real() {
   return hausdorff_distance;
 }
 
+/**
+  Compute the distance between two POINTs in SRID 0 directly from their
+  storage format, without building Geometry objects or looking up an SRS.
+
+  @param[in]  wkb1      First geometry, in storage format.
+  @param[in]  wkb2      Second geometry, in storage format.
+  @param[out] distance  Cartesian distance, if the fast path applies.
+
+  @retval true   The distance was computed.
+  @retval false  Not two valid Cartesian points; use the general path.
+*/
+static bool distance_between_srid0_points(const String *wkb1,
+                                          const String *wkb2,
+                                          double *distance) {
+  double x[2], y[2];
+  const String *wkbs[] = {wkb1, wkb2};
+  for (int i = 0; i < 2; i++) {
+    const String *wkb = wkbs[i];
+    if (wkb->length() != SRID_SIZE + WKB_HEADER_SIZE + POINT_DATA_SIZE)
+      return false;
+    const uchar *p = pointer_cast<const uchar *>(wkb->ptr());
+    if (uint4korr(p) != 0 || p[SRID_SIZE] != Geometry::wkb_ndr ||
+        uint4korr(p + SRID_SIZE + 1) != Geometry::wkb_point)
+      return false;
+    x[i] = float8get(p + SRID_SIZE + WKB_HEADER_SIZE);
+    y[i] = float8get(p + SRID_SIZE + WKB_HEADER_SIZE + SIZEOF_STORED_DOUBLE);
+    // Let the general path report invalid coordinates.
+    if (!std::isfinite(x[i]) || !std::isfinite(y[i])) return false;
+  }
+
+  // Same as Boost.Geometry's Pythagoras strategy that gis::distance() uses.
+  const double dx = x[0] - x[1];
+  const double dy = y[0] - y[1];
+  *distance = std::sqrt(dx * dx + dy * dy);
+  return std::isfinite(*distance);
+}
+
 double Item_func_distance::val_real() {
   assert(fixed == 1);
 
@@ -5438,6 +5475,12 @@ double Item_func_distance::val_real() {
     return error_real();
   }
 
+  // Point to point distance in SRID 0 is the most common case by far.
+  double point_distance;
+  if (arg_count == 2 &&
+      distance_between_srid0_points(res1, res2, &point_distance))
+    return point_distance;
+
   const dd::Spatial_reference_system *srs1 = nullptr;
   const dd::Spatial_reference_system *srs2 = nullptr;
   std::unique_ptr<gis::Geometry> g1;
@@ -819,6 +819,35 @@ static bool contains_wr(const THD *thd, const Json_wrapper &doc_wrapper,
     return false;
   }
 
+  if (doc_wrapper.type() == enum_json_type::J_ARRAY &&
+      containee_wr.type() != enum_json_type::J_ARRAY &&
+      containee_wr.type() != enum_json_type::J_OBJECT) {
+    /*
+      A scalar is contained in an array if it is equal to one of its
+      scalar elements or is contained in one of its nested arrays. No
+      object contains a scalar. That is what the general case below
+      computes, but it would first sort the whole document array and wrap
+      the scalar in a DOM array; a single scan of the binary array is
+      enough.
+    */
+    for (size_t i = 0; i < doc_wrapper.length(); i++) {
+      Json_wrapper d_wr = doc_wrapper[i];
+      const auto dtype = d_wr.type();
+      if (dtype == enum_json_type::J_ARRAY) {
+        if (contains_wr(thd, d_wr, containee_wr, result))
+          return true; /* purecov: inspected */
+        if (*result) return false;
+      } else if (dtype != enum_json_type::J_OBJECT &&
+                 d_wr.compare(containee_wr) == 0) {
+        *result = true;
+        return false;
+      }
+    }
+
+    *result = false;
+    return false;
+  }
+
   if (doc_wrapper.type() == enum_json_type::J_ARRAY) {
     const Json_wrapper *wr = &containee_wr;
     Json_wrapper a_wr;
@@ -292,8 +292,13 @@ unique_ptr_destroy_only<RowIterator> CreateIteratorFromAccessPath(
   switch (path->type) {
     case AccessPath::TABLE_SCAN: {
       const auto &param = path->table_scan();
-      iterator = NewIterator<TableScanIterator>(
-          thd, param.table, path->num_output_rows, examined_rows);
+      if (ParallelTableScanIterator::IsEligible(thd, param.table, join)) {
+        iterator = NewIterator<ParallelTableScanIterator>(thd, param.table,
+                                                          examined_rows);
+      } else {
+        iterator = NewIterator<TableScanIterator>(
+            thd, param.table, path->num_output_rows, examined_rows);
+      }
       break;
     }
     case AccessPath::INDEX_SCAN: {
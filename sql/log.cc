@@ -1626,8 +1626,8 @@ bool log_slow_applicable(THD *thd) {
 }
 
 /**
-  Unconditionally writes the current statement (or its rewritten version if it
-  exists) to the slow query log.
+  Writes the current statement (or its rewritten version if it exists) to the
+  slow query log, unless it is skipped by log_slow_sample_rate.
 
   @param thd                 thread handle
   @param query_start_status  Pointer to a snapshot of thd->status_var taken
@@ -1637,6 +1637,18 @@ void log_slow_do(THD *thd, struct System_status_var *query_start_status) {
   THD_STAGE_INFO(thd, stage_logging_slow_query);
   thd->status_var.long_query_count++;
 
+  /*
+    With log_slow_sample_rate=N only every N-th qualifying statement, counted
+    server wide, is written. This keeps long_query_time=0 sampling from
+    turning the slow log into a serialization point.
+  */
+  const ulong sample_rate = opt_log_slow_sample_rate;
+  if (sample_rate > 1) {
+    static std::atomic<ulong> qualified{0};
+    if (qualified.fetch_add(1, std::memory_order_relaxed) % sample_rate != 0)
+      return;
+  }
+
   if (thd->rewritten_query().length())
     query_logger.slow_log_write(thd, thd->rewritten_query().ptr(),
                                 thd->rewritten_query().length(),
@@ -8712,10 +8712,7 @@ int Rows_log_event::close_record_scan() {
   int error = 0;
 
   // if there is something to actually close
-  if (m_key_index < MAX_KEY) {
-    if (m_table->file->inited) error = m_table->file->ha_index_end();
-  } else if (m_table->file->inited)
-    error = m_table->file->ha_rnd_end();
+  if (m_table->file->inited) error = m_table->file->ha_index_or_rnd_end();
 
   return error;
 }
@@ -8933,10 +8930,28 @@ int Rows_log_event::do_index_scan_and_update(Relay_log_info const *rli) {
     */
 
     DBUG_PRINT("info", ("locating record using primary key (position)"));
-    if (m_table->file->inited && (error = m_table->file->ha_index_end()))
+    if (m_table->file->inited == handler::INDEX &&
+        (error = m_table->file->ha_index_end()))
       goto end;
 
-    error = m_table->file->rnd_pos_by_record(m_table->record[0]);
+    if (m_table->part_info != nullptr) {
+      /* Let the partitioning handler pick the right partition. */
+      error = m_table->file->rnd_pos_by_record(m_table->record[0]);
+    } else {
+      /*
+        Same as handler::rnd_pos_by_record(), but the positioned scan is
+        left open for the next row of the event instead of being set up
+        and torn down for every row. It is closed once the event is
+        applied, see do_apply_event().
+      */
+      if (!m_table->file->inited &&
+          (error = m_table->file->ha_rnd_init(false)))
+        goto end;
+
+      m_table->file->position(m_table->record[0]);
+      error = m_table->file->ha_rnd_pos(m_table->record[0],
+                                        m_table->file->ref);
+    }
 
     if (error) {
       DBUG_PRINT("info", ("rnd_pos returns error %d", error));
@@ -9025,9 +9040,11 @@ end:
   else
     error = do_apply_row(rli);
 
-  if (!error)
-    error = close_record_scan();
-  else
+  /*
+    On success the scan is kept open so that the next row of the event
+    can reuse it; do_apply_event() closes it after the last row.
+  */
+  if (error)
     /*
       we are already with errors. Keep the error code and
       try to close the scan anyway.
@@ -9961,6 +9978,14 @@ int Rows_log_event::do_apply_event(Relay_log_info const *rli) {
 
     } while (!error && (m_curr_row != m_rows_end));
 
+    /* do_index_scan_and_update() leaves its scan open between rows. */
+    if (table->file->inited) {
+      if (!error)
+        error = close_record_scan();
+      else
+        (void)close_record_scan();
+    }
+
 #ifdef HAVE_PSI_STAGE_INTERFACE
     m_psi_progress.end_work();
 #endif
@@ -765,6 +765,7 @@ MySQL clients support the protocol:
 #include "sql/derror.h"
 #include "sql/event_data_objects.h"  // init_scheduler_psi_keys
 #include "sql/events.h"              // Events
+#include "sql/filesort_utils.h"      // key_thread_filesort
 #include "sql/handler.h"
 #include "sql/hostname_cache.h"  // hostname_cache_init
 #include "sql/init.h"            // unireg_init
@@ -1145,6 +1146,7 @@ ulonglong log_output_options;
 bool opt_log_queries_not_using_indexes = false;
 ulong opt_log_throttle_queries_not_using_indexes = 0;
 bool opt_log_slow_extra = false;
+ulong opt_log_slow_sample_rate = 1;
 bool opt_disable_networking = false, opt_skip_show_db = false;
 bool opt_skip_name_resolve = false;
 bool opt_character_set_client_handshake = true;
@@ -8642,6 +8644,71 @@ static int show_num_thread_running(THD *, SHOW_VAR *var, char *buff) {
   return 0;
 }
 
+#ifdef HAVE_EPOLL
+static int show_pool_of_threads_threads(THD *, SHOW_VAR *var, char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  long *value = reinterpret_cast<long *>(buff);
+  *value = static_cast<long>(Thread_pool_connection_handler::thread_count);
+  return 0;
+}
+
+static int show_pool_of_threads_idle_threads(THD *, SHOW_VAR *var,
+                                             char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  long *value = reinterpret_cast<long *>(buff);
+  *value =
+      static_cast<long>(Thread_pool_connection_handler::idle_thread_count);
+  return 0;
+}
+
+static int show_pool_of_threads_queue_depth(THD *, SHOW_VAR *var,
+                                            char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  long *value = reinterpret_cast<long *>(buff);
+  *value = static_cast<long>(Thread_pool_connection_handler::queue_depth());
+  return 0;
+}
+
+static int show_pool_of_threads_max_group_queue_depth(THD *, SHOW_VAR *var,
+                                                      char *buff) {
+  var->type = SHOW_LONG;
+  var->value = buff;
+  long *value = reinterpret_cast<long *>(buff);
+  *value = static_cast<long>(
+      Thread_pool_connection_handler::max_group_queue_depth());
+  return 0;
+}
+
+static int show_pool_of_threads_avg_queue_wait(THD *, SHOW_VAR *var,
+                                               char *buff) {
+  var->type = SHOW_LONGLONG;
+  var->value = buff;
+  long long *value = reinterpret_cast<long long *>(buff);
+  *value = static_cast<long long>(
+      Thread_pool_connection_handler::avg_queue_wait_usec());
+  return 0;
+}
+
+static int show_pool_of_threads_stalls(THD *, SHOW_VAR *var, char *buff) {
+  var->type = SHOW_LONGLONG;
+  var->value = buff;
+  long long *value = reinterpret_cast<long long *>(buff);
+  *value = static_cast<long long>(Thread_pool_connection_handler::stall_count);
+  return 0;
+}
+
+static int show_pool_of_threads_steals(THD *, SHOW_VAR *var, char *buff) {
+  var->type = SHOW_LONGLONG;
+  var->value = buff;
+  long long *value = reinterpret_cast<long long *>(buff);
+  *value = static_cast<long long>(Thread_pool_connection_handler::steal_count);
+  return 0;
+}
+#endif  // HAVE_EPOLL
+
 static int show_num_thread_created(THD *, SHOW_VAR *var, char *buff) {
   var->type = SHOW_LONG;
   var->value = buff;
@@ -9178,6 +9245,24 @@ SHOW_VAR status_vars[] = {
     {"Opened_table_definitions",
      (char *)offsetof(System_status_var, opened_shares), SHOW_LONGLONG_STATUS,
      SHOW_SCOPE_ALL},
+#ifdef HAVE_EPOLL
+    {"Pool_of_threads_avg_queue_wait_usec",
+     (char *)&show_pool_of_threads_avg_queue_wait, SHOW_FUNC,
+     SHOW_SCOPE_GLOBAL},
+    {"Pool_of_threads_idle_threads",
+     (char *)&show_pool_of_threads_idle_threads, SHOW_FUNC, SHOW_SCOPE_GLOBAL},
+    {"Pool_of_threads_max_group_queue_depth",
+     (char *)&show_pool_of_threads_max_group_queue_depth, SHOW_FUNC,
+     SHOW_SCOPE_GLOBAL},
+    {"Pool_of_threads_queue_depth", (char *)&show_pool_of_threads_queue_depth,
+     SHOW_FUNC, SHOW_SCOPE_GLOBAL},
+    {"Pool_of_threads_stalls", (char *)&show_pool_of_threads_stalls, SHOW_FUNC,
+     SHOW_SCOPE_GLOBAL},
+    {"Pool_of_threads_steals", (char *)&show_pool_of_threads_steals, SHOW_FUNC,
+     SHOW_SCOPE_GLOBAL},
+    {"Pool_of_threads_threads", (char *)&show_pool_of_threads_threads,
+     SHOW_FUNC, SHOW_SCOPE_GLOBAL},
+#endif  // HAVE_EPOLL
     {"Prepared_stmt_count", (char *)&show_prepared_stmt_count, SHOW_FUNC,
      SHOW_SCOPE_GLOBAL},
     {"Queries", (char *)&show_queries, SHOW_FUNC, SHOW_SCOPE_ALL},
@@ -11022,6 +11107,7 @@ PSI_mutex_key key_thd_timer_mutex;
 PSI_mutex_key key_commit_order_manager_mutex;
 PSI_mutex_key key_mutex_slave_worker_hash;
 PSI_mutex_key key_monitor_info_run_lock;
+PSI_mutex_key key_LOCK_parallel_table_scan;
 
 /* clang-format off */
 static PSI_mutex_info all_server_mutexes[]=
@@ -11107,7 +11193,8 @@ static PSI_mutex_info all_server_mutexes[]=
   { &key_LOCK_tls_ctx_options, "LOCK_tls_ctx_options", 0, 0, "A lock to control all of the --ssl-* CTX related command line options for client server connection port"},
   { &key_LOCK_admin_tls_ctx_options, "LOCK_admin_tls_ctx_options", 0, 0, "A lock to control all of the --ssl-* CTX related command line options for administrative connection port"},
   { &key_LOCK_rotate_binlog_master_key, "LOCK_rotate_binlog_master_key", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
-  { &key_monitor_info_run_lock, "Source_IO_monitor::run_lock", 0, 0, PSI_DOCUMENT_ME}
+  { &key_monitor_info_run_lock, "Source_IO_monitor::run_lock", 0, 0, PSI_DOCUMENT_ME},
+  { &key_LOCK_parallel_table_scan, "ParallelTableScanIterator::m_mutex", 0, 0, PSI_DOCUMENT_ME}
 };
 /* clang-format on */
 
@@ -11177,6 +11264,7 @@ PSI_cond_key key_COND_thr_lock;
 PSI_cond_key key_commit_order_manager_cond;
 PSI_cond_key key_cond_slave_worker_hash;
 PSI_cond_key key_monitor_info_run_cond;
+PSI_cond_key key_COND_parallel_table_scan;
 
 /* clang-format off */
 static PSI_cond_info all_server_conds[]=
@@ -11217,7 +11305,8 @@ static PSI_cond_info all_server_conds[]=
   { &key_COND_compress_gtid_table, "COND_compress_gtid_table", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_commit_order_manager_cond, "Commit_order_manager::m_workers.cond", 0, 0, PSI_DOCUMENT_ME},
   { &key_cond_slave_worker_hash, "Relay_log_info::slave_worker_hash_lock", 0, 0, PSI_DOCUMENT_ME},
-  { &key_monitor_info_run_cond, "Source_IO_monitor::run_cond", 0, 0, PSI_DOCUMENT_ME}
+  { &key_monitor_info_run_cond, "Source_IO_monitor::run_cond", 0, 0, PSI_DOCUMENT_ME},
+  { &key_COND_parallel_table_scan, "ParallelTableScanIterator::m_cond", 0, 0, PSI_DOCUMENT_ME}
 };
 /* clang-format on */
 
@@ -11227,6 +11316,7 @@ PSI_thread_key key_thread_one_connection;
 PSI_thread_key key_thread_compress_gtid_table;
 PSI_thread_key key_thread_parser_service;
 PSI_thread_key key_thread_handle_con_admin_sockets;
+PSI_thread_key key_thread_parallel_table_scan;
 
 /* clang-format off */
 static PSI_thread_info all_server_threads[]=
@@ -11245,6 +11335,8 @@ static PSI_thread_info all_server_threads[]=
   { &key_thread_compress_gtid_table, "compress_gtid_table", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_thread_parser_service, "parser_service", PSI_FLAG_SINGLETON, 0, PSI_DOCUMENT_ME},
   { &key_thread_handle_con_admin_sockets, "admin_interface", PSI_FLAG_USER, 0, PSI_DOCUMENT_ME},
+  { &key_thread_parallel_table_scan, "parallel_table_scan", 0, 0, PSI_DOCUMENT_ME},
+  { &key_thread_filesort, "filesort", 0, 0, PSI_DOCUMENT_ME},
 };
 /* clang-format on */
 
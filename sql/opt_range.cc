@@ -9987,6 +9987,15 @@ int QUICK_RANGE_SELECT::reset() {
 
   RANGE_SEQ_IF seq_funcs = {quick_range_seq_init, quick_range_seq_next, nullptr,
                             nullptr};
+
+  /*
+    With a single range read in index order, all rows we expect come from one
+    stretch of the index, so let the engine read it ahead. DS-MRR reads the
+    table in rowid order instead and gets no hint.
+  */
+  if (ranges.size() == 1 && (mrr_flags & HA_MRR_USE_DEFAULT_IMPL))
+    file->set_range_scan_expected_rows(records);
+
   error =
       file->multi_range_read_init(&seq_funcs, this, ranges.size(), mrr_flags,
                                   mrr_buf_desc ? mrr_buf_desc : &empty_buf);
@@ -307,7 +307,7 @@ int mysql_parser_get_statement_digest(MYSQL_THD thd, uchar *digest) {
                 "needs to adjust");
 
   if (thd->m_digest == nullptr) return true;
-  compute_digest_hash(&thd->m_digest->m_digest_storage, digest);
+  get_digest_hash(&thd->m_digest->m_digest_storage, digest);
   return false;
 }
 
@@ -31,6 +31,7 @@
 
 #include <string.h>
 #include <algorithm>
+#include <cmath>
 #include <atomic>
 #include <new>
 
@@ -38,16 +39,24 @@
 #include "my_dbug.h"
 #include "my_inttypes.h"
 #include "my_sys.h"
+#include "my_systime.h"
+#include "my_thread.h"
+#include "mysql/psi/mysql_thread.h"
+#include "mysqld_error.h"
+#include "template_utils.h"
+#include "thr_lock.h"
 #include "sql/debug_sync.h"
 #include "sql/handler.h"
 #include "sql/item.h"
 #include "sql/join_optimizer/access_path.h"
 #include "sql/key.h"
+#include "sql/mysqld.h"  // key_thread_parallel_table_scan
 #include "sql/opt_explain.h"
 #include "sql/opt_range.h"  // QUICK_SELECT_I
 #include "sql/sql_class.h"  // THD
 #include "sql/sql_const.h"
 #include "sql/sql_executor.h"
+#include "sql/sql_lex.h"
 #include "sql/sql_optimizer.h"
 #include "sql/sql_sort.h"
 #include "sql/sql_tmp_table.h"
@@ -334,6 +343,35 @@ TableScanIterator::~TableScanIterator() {
   }
 }
 
+bool TableScanIterator::UseBatches() const {
+  const ulong batch_rows = thd()->variables.table_scan_batch_rows;
+  if (batch_rows <= 1 || m_expected_rows <= 1.0) return false;
+  if (table()->has_gcol()) return false;
+
+  /*
+    BLOB columns point into engine-owned memory which is only valid until
+    the next row is fetched (InnoDB empties prebuilt->blob_heap per row).
+  */
+  if (table()->s->blob_fields > 0) return false;
+
+  // Locks and semi-consistent reads apply to the last row read.
+  if (thd()->lex->sql_command != SQLCOM_SELECT ||
+      table()->reginfo.lock_type != TL_READ)
+    return false;
+
+  /*
+    The default rnd_next_batch() only adds a copy per row, so it is not
+    worth giving up the engine's prefetch buffer for.
+
+    handler::position() must work from the row contents alone, since the
+    handler has moved past the row by the time the executor sees it.
+  */
+  const handler::Table_flags flags = table()->file->ha_table_flags();
+  return (flags & HA_RND_NEXT_BATCH) &&
+         (flags & HA_PRIMARY_KEY_REQUIRED_FOR_POSITION) &&
+         table()->s->primary_key != MAX_KEY;
+}
+
 bool TableScanIterator::Init() {
   empty_record(table());
 
@@ -349,6 +387,24 @@ bool TableScanIterator::Init() {
     return true;
   }
 
+  m_batch_pos = 0;
+  m_batch_error = 0;
+  m_batch.reset();
+
+  if (first_init && m_batch.max_records() == 0 && UseBatches()) {
+    // Like the record buffer, do not let a batch take more than 1 MB.
+    constexpr size_t max_batch_size = 1024 * 1024;
+    const size_t record_size = table()->s->reclength;
+    const ha_rows rows = std::max<ha_rows>(
+        1, std::min<ha_rows>({thd()->variables.table_scan_batch_rows,
+                              static_cast<ha_rows>(std::ceil(m_expected_rows)),
+                              max_batch_size / std::max<size_t>(1, record_size)}));
+    const auto ptr = pointer_cast<uchar *>(
+        thd()->alloc(Record_buffer::buffer_size(rows, record_size)));
+    if (ptr == nullptr) return true; /* purecov: inspected */
+    m_batch = Record_buffer{rows, record_size, ptr};
+  }
+
   if (first_init && set_record_buffer(table(), m_expected_rows)) {
     return true; /* purecov: inspected */
   }
@@ -356,7 +412,27 @@ bool TableScanIterator::Init() {
   return false;
 }
 
+int TableScanIterator::ReadFromBatch() {
+  while (m_batch_pos == m_batch.records()) {
+    if (m_batch_error != 0) return HandleError(m_batch_error);
+    if (thd()->killed) {
+      thd()->send_kill_message();
+      return 1;
+    }
+    m_batch_pos = 0;
+    m_batch_error = table()->file->ha_rnd_next_batch(&m_batch);
+  }
+  memcpy(m_record, m_batch.record(m_batch_pos++), m_batch.record_size());
+  table()->set_found_row();
+  if (m_examined_rows != nullptr) {
+    ++*m_examined_rows;
+  }
+  return 0;
+}
+
 int TableScanIterator::Read() {
+  if (m_batch.max_records() > 0) return ReadFromBatch();
+
   int tmp;
   while ((tmp = table()->file->ha_rnd_next(m_record))) {
     /*
@@ -372,6 +448,238 @@ int TableScanIterator::Read() {
   return 0;
 }
 
+ParallelTableScanIterator::ParallelTableScanIterator(THD *thd, TABLE *table,
+                                                     ha_rows *examined_rows)
+    : TableRowIterator(thd, table),
+      m_record(table->record[0]),
+      m_examined_rows(examined_rows) {
+  mysql_mutex_init(key_LOCK_parallel_table_scan, &m_mutex, MY_MUTEX_INIT_FAST);
+  mysql_cond_init(key_COND_parallel_table_scan, &m_cond);
+}
+
+ParallelTableScanIterator::~ParallelTableScanIterator() {
+  StopScan();
+  if (m_scan_file != nullptr && table()->file != nullptr) {
+    m_scan_file->ha_close();
+    destroy(m_scan_file);
+  }
+  mysql_cond_destroy(&m_cond);
+  mysql_mutex_destroy(&m_mutex);
+}
+
+bool ParallelTableScanIterator::IsEligible(THD *thd, const TABLE *table,
+                                           const JOIN *join) {
+  if (!thd->variables.parallel_table_scan) return false;
+  if (thd->lex->sql_command != SQLCOM_SELECT) return false;
+  if (join == nullptr || join->primary_tables != 1) return false;
+  if (!join->grouped && !join->implicit_grouping) return false;
+
+  // Only the outermost query block, which is initialized once.
+  if (join->query_block->outer_query_block() != nullptr) return false;
+  if (!join->query_block->master_query_expression()->is_simple()) return false;
+
+  // The engine threads read a consistent snapshot without row locks.
+  if (table->reginfo.lock_type != TL_READ) return false;
+  if (thd->tx_isolation == ISO_SERIALIZABLE) return false;
+
+  if (table->s->tmp_table != NO_TMP_TABLE) return false;
+  if (table->file->ht->db_type != DB_TYPE_INNODB) return false;
+  if (table->s->blob_fields > 0 || table->vfield != nullptr) return false;
+  return true;
+}
+
+bool ParallelTableScanIterator::Init() {
+  // Init() may be called again to rescan the table.
+  StopScan();
+  empty_record(table());
+
+  m_batches.clear();
+  m_current.clear();
+  m_current_row = m_current_rows = 0;
+  m_scan_done = m_abort = false;
+  m_scan_error = 0;
+
+  /*
+    The helper thread must not share a handler with the executor, so the
+    engine scan runs on a clone that takes part in the same transaction.
+    A rescan, or a failure to set up the clone, reads the table serially.
+  */
+  const bool rescan = m_initialized;
+  m_initialized = true;
+  if (!rescan) {
+    m_scan_file = table()->file->clone(table()->s->normalized_path.str,
+                                       thd()->mem_root);
+  }
+  if (rescan || m_scan_file == nullptr ||
+      m_scan_file->ha_external_lock(thd(), table()->file->get_lock_type()))
+    return InitSerial();
+
+  int error = m_scan_file->parallel_scan_init(m_scan_ctx, &m_num_threads,
+                                              /*use_reserved_threads=*/false);
+  if (error == HA_ERR_GENERIC) {
+    /*
+      All innodb_parallel_read_threads are in use by other scans; read
+      the table serially rather than failing the query.
+    */
+    m_scan_ctx = nullptr;
+    m_scan_file->ha_external_lock(thd(), F_UNLCK);
+    return InitSerial();
+  }
+  if (error) {
+    m_scan_ctx = nullptr;
+    m_scan_file->ha_external_lock(thd(), F_UNLCK);
+    PrintError(error);
+    return true;
+  }
+
+  if (mysql_thread_create(key_thread_parallel_table_scan, &m_scan_thread,
+                          nullptr, ScanThread, this)) {
+    m_scan_file->parallel_scan_end(m_scan_ctx);
+    m_scan_ctx = nullptr;
+    m_scan_file->ha_external_lock(thd(), F_UNLCK);
+    my_error(ER_CANT_CREATE_THREAD, MYF(0), errno);
+    return true;
+  }
+  m_scan_thread_started = true;
+  return false;
+}
+
+bool ParallelTableScanIterator::InitSerial() {
+  const int error = table()->file->ha_rnd_init(true);
+  if (error) {
+    PrintError(error);
+    return true;
+  }
+  m_serial = true;
+  return false;
+}
+
+void *ParallelTableScanIterator::ScanThread(void *arg) {
+  my_thread_init();
+  auto *self = static_cast<ParallelTableScanIterator *>(arg);
+
+  // The engine wants one context pointer per thread; all share "self".
+  std::vector<void *> thread_ctxs(self->m_num_threads, self);
+  int err = self->m_scan_file->parallel_scan(
+      self->m_scan_ctx, thread_ctxs.data(),
+      [self](void *, ulong, ulong row_len, const ulong *, const ulong *,
+             const ulong *) {
+        self->m_row_length.store(row_len);
+        return row_len != self->table()->s->reclength;
+      },
+      [self](void *, uint nrows, void *rowdata, uint64_t) {
+        return self->Load(nrows, rowdata);
+      },
+      [](void *) {});
+
+  mysql_mutex_lock(&self->m_mutex);
+  if (!self->m_abort) self->m_scan_error = err;
+  self->m_scan_done = true;
+  mysql_cond_broadcast(&self->m_cond);
+  mysql_mutex_unlock(&self->m_mutex);
+
+  my_thread_end();
+  return nullptr;
+}
+
+bool ParallelTableScanIterator::Load(uint nrows, const void *rowdata) {
+  const uchar *rows = static_cast<const uchar *>(rowdata);
+  std::vector<uchar> batch(rows, rows + nrows * m_row_length.load());
+
+  mysql_mutex_lock(&m_mutex);
+  // Bound the memory used by batches the executor has not consumed yet.
+  while (!m_abort && m_batches.size() >= 2 * m_num_threads)
+    mysql_cond_wait(&m_cond, &m_mutex);
+  const bool abort = m_abort;
+  if (!abort) {
+    m_batches.push_back(std::move(batch));
+    mysql_cond_broadcast(&m_cond);
+  }
+  mysql_mutex_unlock(&m_mutex);
+  return abort;
+}
+
+void ParallelTableScanIterator::StopScan() {
+  if (m_serial) {
+    if (table()->file != nullptr) table()->file->ha_index_or_rnd_end();
+    m_serial = false;
+  }
+  if (m_scan_thread_started) {
+    mysql_mutex_lock(&m_mutex);
+    m_abort = true;
+    mysql_cond_broadcast(&m_cond);
+    mysql_mutex_unlock(&m_mutex);
+    my_thread_join(&m_scan_thread, nullptr);
+    m_scan_thread_started = false;
+  }
+  if (m_scan_ctx != nullptr) {
+    m_scan_file->parallel_scan_end(m_scan_ctx);
+    m_scan_ctx = nullptr;
+    m_scan_file->ha_external_lock(thd(), F_UNLCK);
+  }
+}
+
+int ParallelTableScanIterator::ReadSerial() {
+  int tmp;
+  while ((tmp = table()->file->ha_rnd_next(m_record))) {
+    if (tmp == HA_ERR_RECORD_DELETED && !thd()->killed) continue;
+    return HandleError(tmp);
+  }
+  if (m_examined_rows != nullptr) {
+    ++*m_examined_rows;
+  }
+  return 0;
+}
+
+int ParallelTableScanIterator::Read() {
+  if (m_serial) return ReadSerial();
+
+  if (m_current_row == m_current_rows) {
+    mysql_mutex_lock(&m_mutex);
+    while (m_batches.empty() && !m_scan_done) {
+      // The engine may take long to fill a batch; do not ignore KILL.
+      if (thd()->killed) {
+        mysql_mutex_unlock(&m_mutex);
+        thd()->send_kill_message();
+        return 1;
+      }
+      struct timespec abstime;
+      set_timespec_nsec(&abstime, 100 * 1000 * 1000ULL);
+      mysql_cond_timedwait(&m_cond, &m_mutex, &abstime);
+    }
+    if (m_batches.empty()) {
+      const int error = m_scan_error;
+      mysql_mutex_unlock(&m_mutex);
+      StopScan();
+      if (error != 0) return HandleError(error);
+      table()->set_no_row();
+      return -1;
+    }
+    m_current = std::move(m_batches.front());
+    m_batches.pop_front();
+    // Set by the engine threads before they queued their first batch.
+    m_current_row_length = m_row_length.load();
+    mysql_cond_broadcast(&m_cond);
+    mysql_mutex_unlock(&m_mutex);
+    m_current_row = 0;
+    m_current_rows = m_current.size() / m_current_row_length;
+  }
+
+  if (thd()->killed) {
+    thd()->send_kill_message();
+    return 1;
+  }
+
+  memcpy(m_record, &m_current[m_current_row * m_current_row_length],
+         m_current_row_length);
+  ++m_current_row;
+  table()->set_found_row();
+  if (m_examined_rows != nullptr) {
+    ++*m_examined_rows;
+  }
+  return 0;
+}
+
 FollowTailIterator::FollowTailIterator(THD *thd, TABLE *table,
                                        double expected_rows,
                                        ha_rows *examined_rows)
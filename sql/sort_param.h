@@ -301,6 +301,7 @@ class Sort_param {
   bool m_force_stable_sort{false};  // Keep relative order of equal elements
   bool m_remove_duplicates{
       false};  ///< Whether we want to remove duplicate rows
+  uint m_sort_threads{1};  ///< Max threads for sorting a buffer in memory
 
   /// If we are removing duplicate rows and merging, contains a buffer where we
   /// can store the last key seen.
@@ -385,21 +386,29 @@ class Sort_param {
     @param  [in,out] longest_addons
        The longest addon field row (sum of all addon fields for any single
        given row) found.
+    @param  threshold   If not nullptr, a previously made key. If the new key
+       does not sort before it (see key_less()), nothing more is stored, and
+       0 is returned.
     @returns Number of bytes stored, or UINT_MAX if the result could not
       provably fit within the destination buffer.
    */
   uint make_sortkey(Bounds_checked_array<uchar> dst,
                     const Mem_root_array<TABLE *> &tables,
-                    size_t *longest_addons);
+                    size_t *longest_addons,
+                    const uchar *threshold = nullptr);
 
   // Adapter for Bounded_queue.
   uint make_sortkey(uchar *dst, size_t dst_len,
-                    const Mem_root_array<TABLE *> &tables) {
+                    const Mem_root_array<TABLE *> &tables,
+                    const uchar *threshold = nullptr) {
     size_t longest_addons = 0;  // Unused.
     return make_sortkey(Bounds_checked_array<uchar>(dst, dst_len), tables,
-                        &longest_addons);
+                        &longest_addons, threshold);
   }
 
+  /// Whether the key made by make_sortkey() at a sorts before the one at b.
+  bool key_less(const uchar *a, const uchar *b) const;
+
   /// Stores the length of a variable-sized key.
   static void store_varlen_key_length(uchar *p, uint sz) { int4store(p, sz); }
 
@@ -445,7 +454,8 @@ class Sort_param {
   enum enum_sort_algorithm {
     FILESORT_ALG_NONE,
     FILESORT_ALG_STD_SORT,
-    FILESORT_ALG_STD_STABLE
+    FILESORT_ALG_STD_STABLE,
+    FILESORT_ALG_RADIX
   };
   enum_sort_algorithm m_sort_algorithm{FILESORT_ALG_NONE};
 
@@ -460,6 +460,11 @@ bool table_def_init(void) {
   }
 
   table_def_cache = new Table_definition_cache(key_memory_table_share);
+  /*
+    Size the hash for the configured number of shares up front, so that
+    filling the cache never rehashes all of it while LOCK_open is held.
+  */
+  table_def_cache->reserve(table_def_size);
   return false;
 }
 
@@ -163,6 +163,16 @@ void compute_digest_hash(const sql_digest_storage *digest_storage,
   SHA_EVP256(digest_storage->m_token_array, digest_storage->m_byte_count, hash);
 }
 
+void get_digest_hash(const sql_digest_storage *digest_storage,
+                     unsigned char *hash) {
+  if (digest_storage->m_hash_computed) {
+    memcpy(hash, digest_storage->m_hash, DIGEST_HASH_SIZE);
+    return;
+  }
+
+  compute_digest_hash(digest_storage, hash);
+}
+
 /*
   Iterate token array and updates digest_text.
 */
@@ -381,6 +391,7 @@ sql_digest_state *digest_add_token(sql_digest_state *state, uint token,
   sql_digest_storage *digest_storage = nullptr;
 
   digest_storage = &state->m_digest_storage;
+  digest_storage->m_hash_computed = false;
 
   /*
     Stop collecting further tokens if digest storage is full or
@@ -623,6 +634,7 @@ sql_digest_state *digest_reduce_token(sql_digest_state *state, uint token_left,
   sql_digest_storage *digest_storage = nullptr;
 
   digest_storage = &state->m_digest_storage;
+  digest_storage->m_hash_computed = false;
 
   /*
     Stop collecting further tokens if digest storage is full.
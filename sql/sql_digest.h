@@ -98,6 +98,11 @@ struct sql_digest_storage {
   bool m_full;
   size_t m_byte_count;
   unsigned char m_hash[DIGEST_HASH_SIZE];
+  /**
+    True when @c m_hash holds the hash of the current token array.
+    Cleared whenever a token is added or reduced.
+  */
+  bool m_hash_computed;
   /** Character set number. */
   uint m_charset_number;
   /**
@@ -129,6 +134,7 @@ struct sql_digest_storage {
     m_byte_count = 0;
     m_charset_number = 0;
     memset(m_hash, 0, DIGEST_HASH_SIZE);
+    m_hash_computed = false;
   }
 
   inline bool is_empty() { return (m_byte_count == 0); }
@@ -149,10 +155,12 @@ struct sql_digest_storage {
       m_charset_number = from->m_charset_number;
       memcpy(m_token_array, from->m_token_array, m_byte_count);
       memcpy(m_hash, from->m_hash, DIGEST_HASH_SIZE);
+      m_hash_computed = from->m_hash_computed;
     } else {
       m_full = false;
       m_byte_count = 0;
       m_charset_number = 0;
+      m_hash_computed = false;
     }
   }
 };
@@ -167,6 +175,16 @@ typedef struct sql_digest_storage sql_digest_storage;
 void compute_digest_hash(const sql_digest_storage *digest_storage,
                          unsigned char *hash);
 
+/**
+  Get a digest hash, reusing the hash already stored in the digest
+  when it is up to date.
+  @param digest_storage The digest
+  @param [out] hash The digest hash. This parameter is a buffer of size
+  @c DIGEST_HASH_SIZE.
+*/
+void get_digest_hash(const sql_digest_storage *digest_storage,
+                     unsigned char *hash);
+
 /**
   Compute a digest text.
   A 'digest text' is a textual representation of a query,
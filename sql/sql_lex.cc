@@ -1012,22 +1012,28 @@ static char *get_text(Lex_input_stream *lip, int pre_skip, int post_skip) {
   uchar c, sep;
   uint found_escape = 0;
   const CHARSET_INFO *cs = lip->m_thd->charset();
+  /*
+    Parser character sets are all ASCII based (mbminlen == 1), so a byte
+    below 0x80 never starts a multi-byte character and the my_ismbchar()
+    call can be skipped for it.
+  */
+  const bool cs_use_mb = use_mb(cs);
+  const bool backslash_escapes =
+      !(lip->m_thd->variables.sql_mode & MODE_NO_BACKSLASH_ESCAPES);
 
   lip->tok_bitmap = 0;
   sep = lip->yyGetLast();  // String should end with this
   while (!lip->eof()) {
     c = lip->yyGet();
     lip->tok_bitmap |= c;
-    {
+    if (cs_use_mb && (c & 0x80)) {
       int l;
-      if (use_mb(cs) &&
-          (l = my_ismbchar(cs, lip->get_ptr() - 1, lip->get_end_of_query()))) {
+      if ((l = my_ismbchar(cs, lip->get_ptr() - 1, lip->get_end_of_query()))) {
         lip->skip_binary(l - 1);
         continue;
       }
     }
-    if (c == '\\' && !(lip->m_thd->variables.sql_mode &
-                       MODE_NO_BACKSLASH_ESCAPES)) {  // Escaped character
+    if (c == '\\' && backslash_escapes) {  // Escaped character
       found_escape = 1;
       if (lip->eof()) return nullptr;
       lip->yySkip();
@@ -1066,13 +1072,12 @@ static char *get_text(Lex_input_stream *lip, int pre_skip, int post_skip) {
 
         for (to = start; str != end; str++) {
           int l;
-          if (use_mb(cs) && (l = my_ismbchar(cs, str, end))) {
+          if (cs_use_mb && (*str & 0x80) && (l = my_ismbchar(cs, str, end))) {
             while (l--) *to++ = *str++;
             str--;
             continue;
           }
-          if (!(lip->m_thd->variables.sql_mode & MODE_NO_BACKSLASH_ESCAPES) &&
-              *str == '\\' && str + 1 != end) {
+          if (backslash_escapes && *str == '\\' && str + 1 != end) {
             switch (*++str) {
               case 'n':
                 *to++ = '\n';
@@ -1419,24 +1419,31 @@ READ_INFO::~READ_INFO() {
 }
 
 /**
-  The logic here is similar with my_mbcharlen, except for GET and PUSH
+  The logic here is similar with my_mbcharlen, except for GET and PUSH.
+  Single-byte charsets and ASCII bytes of ASCII-based multi-byte charsets
+  are always one byte long, which spares the per-byte charset callback for
+  the bulk of the input.
 
   @param[in]  cs  charset info
   @param[in]  chr the first char of sequence
   @param[out] len the length of multi-byte char
 */
-#define GET_MBCHARLEN(cs, chr, len)                     \
-  do {                                                  \
-    len = my_mbcharlen((cs), (chr));                    \
-    if (len == 0 && my_mbmaxlenlen((cs)) == 2) {        \
-      int chr1 = GET;                                   \
-      if (chr1 != my_b_EOF) {                           \
-        len = my_mbcharlen_2((cs), (chr), chr1);        \
-        /* Character is gb18030 or invalid (len = 0) */ \
-        assert(len == 0 || len == 2 || len == 4);       \
-      }                                                 \
-      if (len != 0) PUSH(chr1);                         \
-    }                                                   \
+#define GET_MBCHARLEN(cs, chr, len)                                           \
+  do {                                                                        \
+    if ((cs)->mbmaxlen == 1 || ((uint)(chr) < 0x80 && (cs)->mbminlen == 1)) { \
+      len = 1;                                                                \
+    } else {                                                                  \
+      len = my_mbcharlen((cs), (chr));                                        \
+      if (len == 0 && my_mbmaxlenlen((cs)) == 2) {                            \
+        int chr1 = GET;                                                       \
+        if (chr1 != my_b_EOF) {                                               \
+          len = my_mbcharlen_2((cs), (chr), chr1);                            \
+          /* Character is gb18030 or invalid (len = 0) */                     \
+          assert(len == 0 || len == 2 || len == 4);                           \
+        }                                                                     \
+        if (len != 0) PUSH(chr1);                                             \
+      }                                                                       \
+    }                                                                         \
   } while (0)
 
 /**
@@ -98,6 +98,7 @@
 #include "sql/derror.h"                          // read_texts
 #include "sql/discrete_interval.h"
 #include "sql/events.h"          // Events
+#include "sql/filesort_utils.h"  // max_sort_threads
 #include "sql/hostname_cache.h"  // host_cache_resize
 #include "sql/log.h"
 #include "sql/log_event.h"  // MAX_MAX_ALLOWED_PACKET
@@ -3572,6 +3573,14 @@ static Sys_var_ulong Sys_range_alloc_block_size(
     VALID_RANGE(RANGE_ALLOC_BLOCK_SIZE, UINT32_MAX),
     DEFAULT(RANGE_ALLOC_BLOCK_SIZE), BLOCK_SIZE(1024));
 
+static Sys_var_ulong Sys_mem_root_block_cache_size(
+    "mem_root_block_cache_size",
+    "Upper bound, in bytes, on the freed memory root blocks each connection "
+    "thread keeps for reuse by its next statements. The blocks are freed "
+    "when the thread goes idle. 0 disables the cache",
+    GLOBAL_VAR(mem_root_block_cache_size), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, 512 * 1024), DEFAULT(0), BLOCK_SIZE(1024));
+
 static bool fix_thd_mem_root(sys_var *self, THD *thd, enum_var_type type) {
   if (!self->is_global_persist(type))
     thd->mem_root->set_block_size(thd->variables.query_alloc_block_size);
@@ -3679,14 +3688,55 @@ static Sys_var_ulong Sys_trans_prealloc_size(
     ON_UPDATE(fix_trans_mem_root));
 
 static const char *thread_handling_names[] = {
-    "one-thread-per-connection", "no-threads", "loaded-dynamically", nullptr};
+    "one-thread-per-connection", "no-threads", "pool-of-threads",
+    "loaded-dynamically", nullptr};
 static Sys_var_enum Sys_thread_handling(
     "thread_handling",
     "Define threads usage for handling queries, one of "
-    "one-thread-per-connection, no-threads, loaded-dynamically",
+    "one-thread-per-connection, no-threads, pool-of-threads, "
+    "loaded-dynamically",
     READ_ONLY GLOBAL_VAR(Connection_handler_manager::thread_handling),
     CMD_LINE(REQUIRED_ARG), thread_handling_names, DEFAULT(0));
 
+#ifdef HAVE_EPOLL
+static Sys_var_uint Sys_pool_of_threads_size(
+    "pool_of_threads_size",
+    "Number of thread groups used by thread_handling=pool-of-threads. "
+    "0 means one group per CPU",
+    READ_ONLY GLOBAL_VAR(Thread_pool_connection_handler::pool_size),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, 1024), DEFAULT(0), BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_pool_of_threads_stall_limit(
+    "pool_of_threads_stall_limit",
+    "Milliseconds without progress after which a thread group of "
+    "pool-of-threads is considered stalled and may start another worker",
+    GLOBAL_VAR(Thread_pool_connection_handler::stall_limit),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(10, 60000), DEFAULT(500),
+    BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_pool_of_threads_max_threads(
+    "pool_of_threads_max_threads",
+    "Maximum number of worker threads in all thread groups of "
+    "pool-of-threads",
+    GLOBAL_VAR(Thread_pool_connection_handler::max_threads),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 100000), DEFAULT(100000),
+    BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_pool_of_threads_idle_timeout(
+    "pool_of_threads_idle_timeout",
+    "Seconds an idle pool-of-threads worker waits for work before it exits",
+    GLOBAL_VAR(Thread_pool_connection_handler::idle_timeout),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, UINT_MAX), DEFAULT(60),
+    BLOCK_SIZE(1));
+
+static Sys_var_uint Sys_pool_of_threads_oversubscribe(
+    "pool_of_threads_oversubscribe",
+    "Number of workers of a pool-of-threads thread group allowed to "
+    "execute at the same time before queued sessions have to wait",
+    GLOBAL_VAR(Thread_pool_connection_handler::oversubscribe),
+    CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 1000), DEFAULT(3), BLOCK_SIZE(1));
+#endif  // HAVE_EPOLL
+
 static Sys_var_charptr Sys_secure_file_priv(
     "secure_file_priv",
     "Limit LOAD DATA, SELECT ... OUTFILE, and LOAD_FILE() to files "
@@ -4442,6 +4492,23 @@ static Sys_var_ulong Sys_sort_buffer(
     VALID_RANGE(MIN_SORT_MEMORY, ULONG_MAX), DEFAULT(DEFAULT_SORT_MEMORY),
     BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_sort_threads(
+    "sort_threads",
+    "Maximum number of threads a filesort may use to sort an in-memory "
+    "buffer of keys. Buffers with fewer than 65536 rows are always sorted "
+    "by the calling thread. The default of 1 disables parallel sorting. "
+    "The extra threads are taken from max_sort_threads.",
+    HINT_UPDATEABLE SESSION_VAR(sort_threads), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(1, 64), DEFAULT(1), BLOCK_SIZE(1));
+
+static Sys_var_ulong Sys_max_sort_threads(
+    "max_sort_threads",
+    "Maximum number of threads that all sessions together may use, in "
+    "addition to their own, for sorting in-memory buffers of keys; see "
+    "sort_threads. 0 disables parallel sorting.",
+    GLOBAL_VAR(max_sort_threads), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, 1024), DEFAULT(8), BLOCK_SIZE(1));
+
 /**
   Check sql modes strict_mode, 'NO_ZERO_DATE', 'NO_ZERO_IN_DATE' and
   'ERROR_FOR_DIVISION_BY_ZERO' are used together. If only subset of it
@@ -4877,6 +4944,14 @@ static Sys_var_transaction_read_only Sys_transaction_read_only(
     DEFAULT(0), NO_MUTEX_GUARD, NOT_IN_BINLOG,
     ON_CHECK(check_transaction_read_only));
 
+static Sys_var_ulong Sys_table_scan_batch_rows(
+    "table_scan_batch_rows",
+    "Number of rows a table scan fetches from the storage engine per call, "
+    "for engines that implement batched reads. 0 or 1 fetches one row per "
+    "call",
+    HINT_UPDATEABLE SESSION_VAR(table_scan_batch_rows), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(0, 65536), DEFAULT(0), BLOCK_SIZE(1));
+
 static Sys_var_ulonglong Sys_tmp_table_size(
     "tmp_table_size",
     "If an internal in-memory temporary table in the MEMORY storage engine "
@@ -5070,6 +5145,14 @@ static Sys_var_bool Sys_big_tables(
     "temporary sets on file (Solves most 'table full' errors)",
     HINT_UPDATEABLE SESSION_VAR(big_tables), CMD_LINE(OPT_ARG), DEFAULT(false));
 
+static Sys_var_bool Sys_parallel_table_scan(
+    "parallel_table_scan",
+    "Read the table of a single-table aggregate SELECT with the parallel "
+    "scan threads of the storage engine (see innodb_parallel_read_threads) "
+    "instead of a single-threaded table scan",
+    HINT_UPDATEABLE SESSION_VAR(parallel_table_scan), CMD_LINE(OPT_ARG),
+    DEFAULT(false));
+
 static Sys_var_bit Sys_big_selects("sql_big_selects", "sql_big_selects",
                                    HINT_UPDATEABLE SESSION_VAR(option_bits),
                                    NO_CMD_LINE, OPTION_BIG_SELECTS,
@@ -5701,6 +5784,14 @@ static Sys_var_bool Sys_slow_log_extra(
     NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(check_slow_log_extra),
     ON_UPDATE(nullptr));
 
+static Sys_var_ulong Sys_log_slow_sample_rate(
+    "log_slow_sample_rate",
+    "Write only one out of every N statements that qualify for the slow "
+    "query log. Slow_queries still counts all of them. 1 logs every "
+    "qualifying statement.",
+    GLOBAL_VAR(opt_log_slow_sample_rate), CMD_LINE(REQUIRED_ARG),
+    VALID_RANGE(1, ULONG_MAX), DEFAULT(1), BLOCK_SIZE(1));
+
 static bool check_not_empty_set(sys_var *, THD *, set_var *var) {
   return var->save_result.ulonglong_value == 0;
 }
@@ -193,6 +193,7 @@ struct System_variables {
 
   ulonglong max_heap_table_size;
   ulonglong tmp_table_size;
+  ulong table_scan_batch_rows;
   ulonglong long_query_time;
   bool end_markers_in_json;
   bool windowing_use_high_precision;
@@ -237,6 +238,7 @@ struct System_variables {
   ulong read_rnd_buff_size;
   ulong div_precincrement;
   ulong sortbuff_size;
+  ulong sort_threads;
   ulong max_sp_recursion_depth;
   ulong default_week_format;
   ulong max_seeks_for_key;
@@ -284,6 +286,7 @@ struct System_variables {
 
   bool old_alter_table;
   bool big_tables;
+  bool parallel_table_scan;
 
   plugin_ref table_plugin;
   plugin_ref temp_table_plugin;
@@ -442,27 +442,42 @@ static int free_share(TINA_SHARE *share) {
   '\r'     --  Old Mac OS line ending
   '\n'     --  Traditional Unix and Mac OS X line ending
   '\r''\n' --  DOS\Windows line ending
+
+  The scan works directly on the in-memory window of the file and only
+  goes through get_value() to move the window, so the common case does
+  not pay a bounds check per byte.
 */
 
 static my_off_t find_eoln_buff(Transparent_file *data_buff, my_off_t begin,
                                my_off_t end, int *eoln_len) {
   *eoln_len = 0;
 
-  for (my_off_t x = begin; x < end; x++) {
+  my_off_t x = begin;
+  while (x < end) {
+    if (x < data_buff->start() || x >= data_buff->end()) {
+      /* shift the window; give up on read error or end of file */
+      data_buff->get_value(x);
+      if (x < data_buff->start() || x >= data_buff->end()) return 0;
+    }
+
+    const uchar *window = data_buff->ptr() + (x - data_buff->start());
+    const uchar *p = window;
+    const uchar *window_end = window + (min(end, data_buff->end()) - x);
+    while (p < window_end && *p != '\n' && *p != '\r') p++;
+    x += p - window;
+
+    if (p == window_end) continue;
+
     /* Unix (includes Mac OS X) */
-    if (data_buff->get_value(x) == '\n')
+    if (*p == '\n')
       *eoln_len = 1;
-    else if (data_buff->get_value(x) == '\r')  // Mac or Dos
-    {
-      /* old Mac line ending */
-      if (x + 1 == end || (data_buff->get_value(x + 1) != '\n'))
-        *eoln_len = 1;
-      else  // DOS style ending
-        *eoln_len = 2;
-    }
+    /* Mac or Dos; old Mac line ending unless followed by '\n' */
+    else if (x + 1 == end || (data_buff->get_value(x + 1) != '\n'))
+      *eoln_len = 1;
+    else  // DOS style ending
+      *eoln_len = 2;
 
-    if (*eoln_len)  // end of line was found
-      return x;
+    return x;
   }
 
   return 0;
@@ -5423,6 +5423,180 @@ int64_t btr_estimate_n_rows_in_range(dict_index_t *index,
   return (ret);
 }
 
+/** Starts asynchronous reads of the given pages of an index in a single AIO
+batch, skipping the pages which are in the buffer pool.
+@param[in]	index		index
+@param[in]	page_nos	pages to read
+@param[in]	n_pages		number of pages in page_nos
+@return number of pages read */
+static ulint btr_cur_read_pages_in_background(const dict_index_t *index,
+                                              const page_no_t *page_nos,
+                                              ulint n_pages) {
+  const space_id_t space_id = dict_index_get_space(index);
+  const page_size_t page_size(dict_table_page_size(index->table));
+  ulint n_read = 0;
+
+  os_aio_batch_start();
+
+  for (ulint i = 0; i < n_pages; ++i) {
+    if (buf_read_page_background(page_id_t(space_id, page_nos[i]), page_size,
+                                 false)) {
+      ++n_read;
+    }
+  }
+
+  os_aio_batch_submit();
+
+  if (n_read > 0) {
+    os_aio_simulated_wake_handler_threads();
+  }
+
+  return (n_read);
+}
+
+ulint btr_cur_prefetch_leaves(dict_index_t *index, const dtuple_t *tuple,
+                              ulint n_pages) {
+  ut_ad(!dict_index_is_spatial(index));
+  ut_ad(dtuple_get_n_fields(tuple) > 0);
+
+  std::array<page_no_t, BTR_CUR_PREFETCH_LEAVES_MAX> page_nos;
+  ulint n_found = 0;
+
+  n_pages = std::min(n_pages, BTR_CUR_PREFETCH_LEAVES_MAX);
+
+  mtr_t mtr;
+
+  mtr_start(&mtr);
+
+  /* Same latching as in dict_stats_analyze_index_level(): the index SX-latch
+  keeps the tree shape from changing while we read the parent level. This is
+  only read-ahead, so do not wait for it behind a tree modification. */
+  rw_lock_t *lock = dict_index_get_lock(index);
+
+  if (!rw_lock_sx_lock_nowait(lock, 0)) {
+    mtr_commit(&mtr);
+    return (0);
+  }
+
+  mtr_memo_push(&mtr, lock, MTR_MEMO_SX_LOCK);
+
+  if (btr_height_get(index, &mtr) > 0) {
+    btr_cur_t cursor;
+
+    btr_cur_search_to_nth_level(index, 1, tuple, PAGE_CUR_LE,
+                                BTR_SEARCH_TREE | BTR_ALREADY_S_LATCHED,
+                                &cursor, 0, __FILE__, __LINE__, &mtr);
+
+    mem_heap_t *heap = nullptr;
+    ulint *offsets = nullptr;
+
+    /* The node pointer at the cursor is for the leaf the scan starts on,
+    which the scan reads right away. */
+    const rec_t *rec = page_rec_get_next_const(btr_cur_get_rec(&cursor));
+
+    for (; n_found < n_pages && !page_rec_is_supremum(rec);
+         rec = page_rec_get_next_const(rec)) {
+      offsets = rec_get_offsets(rec, index, offsets, ULINT_UNDEFINED, &heap);
+
+      page_nos[n_found++] = btr_node_ptr_get_child_page_no(rec, offsets);
+    }
+
+    if (heap != nullptr) {
+      mem_heap_free(heap);
+    }
+  }
+
+  mtr_commit(&mtr);
+
+  return (btr_cur_read_pages_in_background(index, page_nos.data(), n_found));
+}
+
+ulint btr_cur_prefetch_leaves_for_keys(
+    dict_index_t *index, const std::function<const dtuple_t *()> &next_key) {
+  ut_ad(!dict_index_is_spatial(index));
+
+  std::array<page_no_t, BTR_CUR_PREFETCH_LEAVES_MAX> page_nos;
+  ulint n_read = 0;
+  const dtuple_t *tuple = next_key();
+
+  while (tuple != nullptr) {
+    ulint n_found = 0;
+    mem_heap_t *heap = nullptr;
+    ulint *offsets = nullptr;
+    mtr_t mtr;
+
+    mtr_start(&mtr);
+
+    /* Same latching as in btr_cur_prefetch_leaves(). */
+    mtr_sx_lock(dict_index_get_lock(index), &mtr);
+
+    if (btr_height_get(index, &mtr) == 0) {
+      /* The root is the only leaf, and the lookups will read it anyway. */
+      mtr_commit(&mtr);
+      return (n_read);
+    }
+
+    /* Search the parent page for the first key, then walk along it for the
+    keys which follow, until we run off the page or collect a batch. The
+    latches are released in between batches, so that we do not hold up
+    tree modifications for long. */
+    btr_cur_t cursor;
+
+    btr_cur_search_to_nth_level(index, 1, tuple, PAGE_CUR_LE,
+                                BTR_SEARCH_TREE | BTR_ALREADY_S_LATCHED,
+                                &cursor, 0, __FILE__, __LINE__, &mtr);
+
+    const rec_t *rec = btr_cur_get_rec(&cursor);
+
+    if (page_rec_is_infimum(rec)) {
+      rec = page_rec_get_next_const(rec);
+    }
+
+    while (tuple != nullptr && n_found < page_nos.size()) {
+      /* Move to the last node pointer which is not greater than the key. */
+      const rec_t *next = page_rec_get_next_const(rec);
+
+      while (!page_rec_is_supremum(next)) {
+        offsets =
+            rec_get_offsets(next, index, offsets, ULINT_UNDEFINED, &heap);
+
+        if (cmp_dtuple_rec(tuple, next, index, offsets) < 0) {
+          break;
+        }
+
+        rec = next;
+        next = page_rec_get_next_const(rec);
+      }
+
+      if (page_rec_is_supremum(next) && n_found > 0) {
+        /* The key may belong to a later parent page: search for it again
+        from the root. */
+        break;
+      }
+
+      offsets = rec_get_offsets(rec, index, offsets, ULINT_UNDEFINED, &heap);
+
+      const page_no_t page_no = btr_node_ptr_get_child_page_no(rec, offsets);
+
+      if (n_found == 0 || page_nos[n_found - 1] != page_no) {
+        page_nos[n_found++] = page_no;
+      }
+
+      tuple = next_key();
+    }
+
+    if (heap != nullptr) {
+      mem_heap_free(heap);
+    }
+
+    mtr_commit(&mtr);
+
+    n_read += btr_cur_read_pages_in_background(index, page_nos.data(), n_found);
+  }
+
+  return (n_read);
+}
+
 /** Record the number of non_null key values in a given index for
  each n-column prefix of the index where 1 <= n <=
  dict_index_get_n_unique(index). The estimates are eventually stored in the
@@ -118,6 +118,36 @@ struct set_numa_interleave_t {
 };
 
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE set_numa_interleave_t scoped_numa
+
+/** Choose the NUMA node of a buffer pool instance for
+innodb_numa_buffer_pool_bind. The instances are assigned round-robin to the
+nodes that this process may allocate memory from.
+@param[in]	instance_no	buffer pool instance number
+@return NUMA node, or -1 if the instance is not to be bound to a node */
+static int buf_pool_numa_node(ulint instance_no) {
+  if (!srv_numa_buffer_pool_bind || srv_numa_interleave ||
+      numa_available() == -1) {
+    return (-1);
+  }
+
+  struct bitmask *numa_nodes = numa_get_mems_allowed();
+  const int n_nodes = static_cast<int>(numa_bitmask_weight(numa_nodes));
+  int node = -1;
+
+  if (n_nodes > 1) {
+    int nth = static_cast<int>(instance_no % n_nodes);
+
+    for (int i = 0; i <= numa_max_node(); ++i) {
+      if (numa_bitmask_isbitset(numa_nodes, i) && nth-- == 0) {
+        node = i;
+        break;
+      }
+    }
+  }
+
+  numa_bitmask_free(numa_nodes);
+  return (node);
+}
 #else
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE
 #endif /* HAVE_LIBNUMA */
@@ -1019,6 +1049,21 @@ static buf_chunk_t *buf_chunk_init(
                              << strerror(errno) << ").";
     }
     numa_bitmask_free(numa_nodes);
+  } else if (buf_pool->numa_node >= 0) {
+    /* Prefer rather than bind, so that running out of memory on the node
+    falls back to other nodes instead of failing the allocation. */
+    struct bitmask *numa_nodes = numa_allocate_nodemask();
+    numa_bitmask_setbit(numa_nodes, buf_pool->numa_node);
+    int st = mbind(chunk->mem, chunk->mem_size(), MPOL_PREFERRED,
+                   numa_nodes->maskp, numa_nodes->size, MPOL_MF_MOVE);
+    if (st != 0) {
+      ib::warn(ER_IB_MSG_54) << "Failed to set NUMA memory policy of"
+                                " buffer pool page frames to MPOL_PREFERRED"
+                                " node "
+                             << buf_pool->numa_node
+                             << " (error: " << strerror(errno) << ").";
+    }
+    numa_bitmask_free(numa_nodes);
   }
 #endif /* HAVE_LIBNUMA */
 
@@ -1212,6 +1257,12 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
   ulint chunk_size;
   buf_chunk_t *chunk;
 
+#ifdef HAVE_LIBNUMA
+  buf_pool->numa_node = buf_pool_numa_node(instance_no);
+#else
+  buf_pool->numa_node = -1;
+#endif /* HAVE_LIBNUMA */
+
 #ifdef UNIV_LINUX
   cpu_set_t cpuset;
 
@@ -1223,7 +1274,23 @@ static void buf_pool_create(buf_pool_t *buf_pool, ulint buf_pool_size,
 
   buf_pool->stat.reset();
 
-  if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == -1) {
+  bool on_numa_node = false;
+
+#ifdef HAVE_LIBNUMA
+  /* Run on the node of the instance, so that the structures allocated below
+  are local to it as well. */
+  if (buf_pool->numa_node >= 0) {
+    on_numa_node = numa_run_on_node(buf_pool->numa_node) == 0;
+
+    if (!on_numa_node) {
+      ib::error(ER_IB_ERR_SCHED_SETAFFNINITY_FAILED)
+          << "numa_run_on_node() failed!";
+    }
+  }
+#endif /* HAVE_LIBNUMA */
+
+  if (!on_numa_node &&
+      pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == -1) {
     ib::error(ER_IB_ERR_SCHED_SETAFFNINITY_FAILED)
         << "sched_setaffinity() failed!";
   }
@@ -1463,6 +1530,13 @@ dberr_t buf_pool_init(ulint total_size, ulint n_instances) {
 
   NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE;
 
+#ifdef HAVE_LIBNUMA
+  if (srv_numa_buffer_pool_bind && srv_numa_interleave) {
+    ib::warn(ER_IB_MSG_48) << "innodb_numa_buffer_pool_bind is ignored"
+                              " because innodb_numa_interleave is set.";
+  }
+#endif /* HAVE_LIBNUMA */
+
   /* Usually buf_pool_should_madvise is protected by buf_pool_t::chunk_mutex-es,
   but at this point in time there is no buf_pool_t instances yet, and no risk of
   race condition with sys_var modifications or buffer pool resizing because we
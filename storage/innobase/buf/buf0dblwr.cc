@@ -1511,6 +1511,8 @@ void Double_write::write_pages(buf_flush_t flush_type) noexcept {
 
   batch_segment->set_batch_size(m_buf_pages.size());
 
+  os_aio_batch_start();
+
   /* 写入 double-write 文件完成后, 将 Page 分别写入对应的数据文件. */
   for (uint32_t i = 0; i < m_buf_pages.size(); ++i) {
     /* 获取对应的数据 Page. */
@@ -1550,6 +1552,9 @@ void Double_write::write_pages(buf_flush_t flush_type) noexcept {
 #endif /* UNIV_DEBUG */
   }
 
+  /* With native aio the writes of the whole batch are submitted in one go. */
+  os_aio_batch_submit();
+
   srv_stats.dblwr_writes.inc();
 
   m_buf_pages.clear();
@@ -1743,12 +1748,23 @@ dberr_t dblwr::write(buf_flush_t flush_type, buf_page_t *bpage,
     return DB_SUCCESS;
   }
 
-  if (srv_read_only_mode || fsp_is_system_temporary(space_id) ||
-      !dblwr::enabled || Double_write::s_instances == nullptr ||
-      mtr_t::s_logging.dblwr_disabled()) {
+  const fil_space_t *space = bpage->get_space();
+
+  const bool no_dblwr = srv_read_only_mode ||
+                        fsp_is_system_temporary(space_id) || !dblwr::enabled ||
+                        Double_write::s_instances == nullptr ||
+                        mtr_t::s_logging.dblwr_disabled();
+
+  if (no_dblwr || space->atomic_write) {
+    /* Count only the pages that atomic writes keep out of the doublewrite
+    buffer. Pages of temporary tablespaces need no torn page protection
+    either way. */
+    if (!no_dblwr && space->purpose != FIL_TYPE_TEMPORARY) {
+      srv_stats.dblwr_atomic_bytes_saved.add(bpage->size.physical());
+    }
     /* Skip the double-write buffer since it is not needed. Temporary
     tablespaces are never recovered, therefore we don't care about
-    torn writes. */
+    torn writes. Tablespaces with atomic writes cannot have torn pages. */
     /* 对于上述条件，不需要走 double-write buffer 情况, 直接通过
      * Double_write::write_to_datafile 完成数据 Page 写入. */
     bpage->set_dblwr_batch_id(std::numeric_limits<uint16_t>::max());
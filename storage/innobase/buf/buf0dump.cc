@@ -34,6 +34,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <stdarg.h>
 #include <stdio.h>
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "buf0buf.h"
 #include "buf0dump.h"
@@ -75,6 +77,13 @@ typedef ib_uint64_t buf_dump_t;
 #define BUF_DUMP_SPACE(a) static_cast<space_id_t>((a) >> 32)
 #define BUF_DUMP_PAGE(a) static_cast<page_no_t>((a)&0xFFFFFFFFUL)
 
+/** Number of batches buf_load() splits the dump into. Each batch is read in
+(space, page) order and the batches in dump order, i.e. hottest first. */
+static constexpr ulint BUF_LOAD_N_BATCHES = 16;
+
+/** Minimum number of pages in a buf_load() batch. */
+static constexpr ulint BUF_LOAD_MIN_BATCH_SIZE = 4096;
+
 /** Wakes up the buffer pool dump/load thread and instructs it to start
  a dump. This function is called by MySQL code via buffer_pool_dump_now()
  and it should return immediately because the whole MySQL is frozen during
@@ -246,6 +255,20 @@ static void buf_dump(ibool obey_shutdown) {
   }
   /* else */
 
+  /* Copy the LRU list of each instance, most recently used pages first.
+  The copies are written out interleaved by LRU position below, so that the
+  hottest pages of all instances come first in the file and are the first
+  ones read by buf_load(). */
+  std::vector<std::pair<buf_dump_t *, ulint>> dumps;
+  ulint n_total = 0;
+  ulint n_max = 0;
+
+  auto free_dumps = [&dumps]() {
+    for (auto &d : dumps) {
+      ut_free(d.first);
+    }
+  };
+
   /* walk through each buffer pool */
   for (i = 0; i < srv_buf_pool_instances && !SHOULD_QUIT(); i++) {
     buf_pool_t *buf_pool;
@@ -282,6 +305,7 @@ static void buf_dump(ibool obey_shutdown) {
 
     if (dump == nullptr) {
       mutex_exit(&buf_pool->LRU_list_mutex);
+      free_dumps();
       fclose(f);
       buf_dump_status(STATUS_ERR, "Cannot allocate " ULINTPF " bytes: %s",
                       (ulint)(n_pages * sizeof(*dump)), strerror(errno));
@@ -301,11 +325,23 @@ static void buf_dump(ibool obey_shutdown) {
 
     mutex_exit(&buf_pool->LRU_list_mutex);
 
-    for (j = 0; j < n_pages && !SHOULD_QUIT(); j++) {
-      ret = fprintf(f, SPACE_ID_PF "," PAGE_NO_PF "\n", BUF_DUMP_SPACE(dump[j]),
-                    BUF_DUMP_PAGE(dump[j]));
+    dumps.emplace_back(dump, n_pages);
+    n_total += n_pages;
+    n_max = std::max(n_max, n_pages);
+  }
+
+  ulint n_written = 0;
+
+  for (ulint j = 0; j < n_max && !SHOULD_QUIT(); j++) {
+    for (const auto &d : dumps) {
+      if (j >= d.second) {
+        continue;
+      }
+
+      ret = fprintf(f, SPACE_ID_PF "," PAGE_NO_PF "\n",
+                    BUF_DUMP_SPACE(d.first[j]), BUF_DUMP_PAGE(d.first[j]));
       if (ret < 0) {
-        ut_free(dump);
+        free_dumps();
         fclose(f);
         buf_dump_status(STATUS_ERR, "Cannot write to '%s': %s", tmp_filename,
                         strerror(errno));
@@ -313,19 +349,19 @@ static void buf_dump(ibool obey_shutdown) {
         return;
       }
 
-      if (j % 128 == 0) {
+      if (n_written % 128 == 0) {
         buf_dump_status(STATUS_VERBOSE,
-                        "Dumping buffer pool"
-                        " " ULINTPF "/" ULINTPF
-                        ","
+                        "Dumping buffer pool(s)"
                         " page " ULINTPF "/" ULINTPF,
-                        i + 1, srv_buf_pool_instances, j + 1, n_pages);
+                        n_written + 1, n_total);
       }
-    }
 
-    ut_free(dump);
+      ++n_written;
+    }
   }
 
+  free_dumps();
+
   ret = fclose(f);
   if (ret != 0) {
     buf_dump_status(STATUS_ERR, "Cannot close '%s': %s", tmp_filename,
@@ -559,15 +595,20 @@ static void buf_load() {
   }
 
   if (!SHUTTING_DOWN()) {
-    std::sort(dump, dump + dump_n);
+    const ulint batch_size =
+        std::max(dump_n / BUF_LOAD_N_BATCHES, BUF_LOAD_MIN_BATCH_SIZE);
+
+    for (ulint b = 0; b < dump_n; b += batch_size) {
+      std::sort(dump + b, dump + std::min(b + batch_size, dump_n));
+    }
   }
 
   ib_time_monotonic_ms_t last_check_time = 0;
   ulint last_activity_cnt = 0;
 
   /* Avoid calling the expensive fil_space_acquire_silent() for each
-  page within the same tablespace. dump[] is sorted by (space, page),
-  so all pages from a given tablespace are consecutive. */
+  page within the same tablespace. Each batch of dump[] is sorted by
+  (space, page), so pages from a given tablespace are mostly consecutive. */
   space_id_t cur_space_id = BUF_DUMP_SPACE(dump[0]);
   fil_space_t *space = fil_space_acquire_silent(cur_space_id);
   page_size_t page_size(space ? space->flags : 0);
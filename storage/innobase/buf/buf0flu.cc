@@ -64,6 +64,10 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "ut0byte.h"
 #include "ut0stage.h"
 
+#ifdef HAVE_LIBNUMA
+#include <numa.h>
+#endif /* HAVE_LIBNUMA */
+
 #ifdef UNIV_LINUX
 /* include defs for CPU time priority settings */
 #include <sys/resource.h>
@@ -226,8 +230,10 @@ As of now we'll have only one coordinator.
 @param[in]	n_page_cleaners	Number of page cleaner threads to create */
 static void buf_flush_page_coordinator_thread(size_t n_page_cleaners);
 
-/** Worker thread of page_cleaner. */
-static void buf_flush_page_cleaner_thread();
+/** Worker thread of page_cleaner.
+@param[in]	worker_no	index of the worker in
+                                srv_threads.m_page_cleaner_workers */
+static void buf_flush_page_cleaner_thread(size_t worker_no);
 
 /** Increases flush_list size in bytes with the page size in inline function */
 static inline void incr_flush_list_size_in_bytes(
@@ -1782,7 +1788,9 @@ static ulint buf_flush_LRU_list_batch(buf_pool_t *buf_pool, ulint max) {
 
   for (bpage = UT_LIST_GET_LAST(buf_pool->LRU);
        bpage != nullptr && count + evict_count < max &&
-       free_len < srv_LRU_scan_depth + withdraw_depth &&
+       free_len < std::max(static_cast<ulint>(srv_LRU_scan_depth),
+                           buf_pool->LRU_free_target) +
+                      withdraw_depth &&
        lru_len > BUF_LRU_MIN_LEN;
        ++scanned, bpage = buf_pool->lru_hp.get()) {
     ut_ad(mutex_own(&buf_pool->LRU_list_mutex));
@@ -2259,15 +2267,33 @@ static ulint buf_flush_LRU_list(buf_pool_t *buf_pool) {
 
   ut_ad(buf_pool);
 
-  /* srv_LRU_scan_depth can be arbitrarily large value.
+  /* Threads that found the free list empty since the last batch had to
+  flush a page themselves. Double the free list target while that keeps
+  happening, so that the next batches free blocks ahead of the demand, and
+  halve the excess over srv_LRU_scan_depth when it stops. The target is
+  capped at 1/16 of the instance. */
+  const ulint min_target = srv_LRU_scan_depth;
+  const ulint max_target = std::max(min_target, buf_pool->curr_size / 16);
+  ulint free_target = std::max(min_target, buf_pool->LRU_free_target);
+
+  if (buf_pool->n_free_list_misses.exchange(0, std::memory_order_relaxed) >
+      0) {
+    free_target = std::min(free_target * 2, max_target);
+  } else {
+    free_target -= (free_target - min_target) / 2;
+  }
+
+  buf_pool->LRU_free_target = free_target;
+
+  /* free_target can be arbitrarily large value.
   We cap it with current LRU size. */
   scan_depth = UT_LIST_GET_LEN(buf_pool->LRU);
   withdraw_depth = buf_get_withdraw_depth(buf_pool);
 
-  if (withdraw_depth > srv_LRU_scan_depth) {
+  if (withdraw_depth > free_target) {
     scan_depth = ut_min(withdraw_depth, scan_depth);
   } else {
-    scan_depth = ut_min(static_cast<ulint>(srv_LRU_scan_depth), scan_depth);
+    scan_depth = ut_min(free_target, scan_depth);
   }
 
   /* Currently one of page_cleaners is the only thread
@@ -2560,8 +2586,15 @@ ulint set_flush_target_by_lsn(bool sync_flush, lsn_t sync_flush_limit_lsn) {
 
   lsn_t age = cur_iter_lsn > oldest_lsn ? cur_iter_lsn - oldest_lsn : 0;
 
+  /* Judge redo pressure by the age expected once the pages requested now
+  are written, i.e. over the same horizon as target_lsn below. Flushing then
+  ramps up before a quickly growing age crosses the thresholds rather than
+  after it, which avoids bursts of flushing near the async limit. */
+  const lsn_t predicted_age =
+      sync_flush ? age : age + lsn_avg_rate * buf_flush_lsn_scan_factor;
+
   ulint pct_for_dirty = get_pct_for_dirty();
-  ulint pct_for_lsn = get_pct_for_lsn(age);
+  ulint pct_for_lsn = get_pct_for_lsn(predicted_age);
   ulint pct_total = ut_max(pct_for_dirty, pct_for_lsn);
 
   /* Estimate pages to be flushed for the lsn progress */
@@ -2935,6 +2968,53 @@ static void pc_request(ulint min_n, lsn_t lsn_limit) {
   mutex_exit(&page_cleaner->mutex);
 }
 
+/** NUMA node that the current page cleaner thread runs on, or -1. */
+static thread_local int pc_numa_node = -1;
+
+/** Run the current page cleaner thread on the NUMA node of the buffer pool
+instance with the same index as the worker, if innodb_numa_buffer_pool_bind
+is in effect. With as many page cleaners as buffer pool instances, this puts
+one page cleaner on the node of every instance.
+@param[in]	worker_no	index of the page cleaner thread */
+static void pc_bind_to_numa_node(size_t worker_no) {
+#ifdef HAVE_LIBNUMA
+  const buf_pool_t *buf_pool =
+      buf_pool_from_array(worker_no % srv_buf_pool_instances);
+
+  if (buf_pool->numa_node < 0) {
+    return;
+  }
+
+  if (numa_run_on_node(buf_pool->numa_node) != 0) {
+    ib::warn(ER_IB_MSG_129) << "Failed to bind page_cleaner thread "
+                            << worker_no << " to NUMA node "
+                            << buf_pool->numa_node;
+    return;
+  }
+
+  pc_numa_node = buf_pool->numa_node;
+#else
+  static_cast<void>(worker_no);
+#endif /* HAVE_LIBNUMA */
+}
+
+/** Find a slot in PAGE_CLEANER_STATE_REQUESTED state.
+@param[in]	numa_node	only consider slots of buffer pool instances on
+                                this NUMA node, or any slot if -1
+@return slot index, or page_cleaner->n_slots if none was found */
+static ulint pc_find_requested_slot(int numa_node) {
+  ut_ad(mutex_own(&page_cleaner->mutex));
+
+  for (ulint i = 0; i < page_cleaner->n_slots; i++) {
+    if (page_cleaner->slots[i].state == PAGE_CLEANER_STATE_REQUESTED &&
+        (numa_node < 0 || buf_pool_from_array(i)->numa_node == numa_node)) {
+      return (i);
+    }
+  }
+
+  return (page_cleaner->n_slots);
+}
+
 /**
 Do flush for one slot.
 @return	the number of the slots which has not been treated yet. */
@@ -2948,20 +3028,19 @@ static ulint pc_flush_slot(void) {
 
   if (page_cleaner->n_slots_requested > 0) {
     page_cleaner_slot_t *slot = nullptr;
-    ulint i;
-
-    for (i = 0; i < page_cleaner->n_slots; i++) {
-      slot = &page_cleaner->slots[i];
+    ulint i = pc_find_requested_slot(pc_numa_node);
 
-      if (slot->state == PAGE_CLEANER_STATE_REQUESTED) {
-        break;
-      }
+    if (i == page_cleaner->n_slots && pc_numa_node >= 0) {
+      /* Nothing requested on our node: help the other nodes. */
+      i = pc_find_requested_slot(-1);
     }
 
     /* slot should be found because
     page_cleaner->n_slots_requested > 0 */
     ut_a(i < page_cleaner->n_slots);
 
+    slot = &page_cleaner->slots[i];
+
     buf_pool_t *buf_pool = buf_pool_from_array(i);
 
     page_cleaner->n_slots_requested--;
@@ -3204,6 +3283,9 @@ static void buf_flush_page_coordinator_thread(size_t n_page_cleaners) {
 
   THD *thd = create_thd(false, true, true, 0);
 
+  /* The coordinator is page cleaner worker 0. */
+  pc_bind_to_numa_node(0);
+
 #ifdef UNIV_LINUX
   /* linux might be able to set different setting for each thread.
   worth to try to set high priority for page cleaner threads */
@@ -3221,7 +3303,8 @@ static void buf_flush_page_coordinator_thread(size_t n_page_cleaners) {
   same set */
   for (size_t i = 1; i < srv_threads.m_page_cleaner_workers_n; ++i) {
     srv_threads.m_page_cleaner_workers[i] =
-        os_thread_create(page_flush_thread_key, buf_flush_page_cleaner_thread);
+        os_thread_create(page_flush_thread_key, buf_flush_page_cleaner_thread,
+                         i);
 
     srv_threads.m_page_cleaner_workers[i].start();
   }
@@ -3581,8 +3664,12 @@ thread_exit:
   destroy_thd(thd);
 }
 
-/** Worker thread of page_cleaner. */
-static void buf_flush_page_cleaner_thread() {
+/** Worker thread of page_cleaner.
+@param[in]	worker_no	index of the worker in
+                                srv_threads.m_page_cleaner_workers */
+static void buf_flush_page_cleaner_thread(size_t worker_no) {
+  pc_bind_to_numa_node(worker_no);
+
 #ifdef UNIV_LINUX
   /* linux might be able to set different setting for each thread
   worth to try to set high priority for page cleaner threads */
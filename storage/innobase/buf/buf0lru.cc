@@ -1273,6 +1273,10 @@ loop:
 
   MONITOR_INC(MONITOR_LRU_GET_FREE_LOOPS);
 
+  if (n_iterations == 0) {
+    buf_pool->n_free_list_misses.fetch_add(1, std::memory_order_relaxed);
+  }
+
   freed = false;
   os_rmb;
   if (buf_pool->try_LRU_scan || n_iterations > 0) {
@@ -240,6 +240,8 @@ read_ahead:
 
   count = 0;
 
+  os_aio_batch_start();
+
   for (i = low; i < high; i++) {
     /* It is only sensible to do read-ahead in the non-sync aio
     mode: hence FALSE as the first parameter */
@@ -261,6 +263,9 @@ read_ahead:
     }
   }
 
+  /* With native aio the whole area is submitted in one go. */
+  os_aio_batch_submit();
+
   /* In simulated aio we wake the aio handler threads only after
   queuing all aio requests.  */
 
@@ -534,6 +539,8 @@ ulint buf_read_ahead_linear(const page_id_t &page_id,
 
   os_aio_simulated_put_read_threads_to_sleep();
 
+  os_aio_batch_start();
+
   for (i = low; i < high; i++) {
     /* It is only sensible to do read-ahead in the non-sync
     aio mode: hence FALSE as the first parameter */
@@ -554,6 +561,9 @@ ulint buf_read_ahead_linear(const page_id_t &page_id,
     }
   }
 
+  /* With native aio the whole area is submitted in one go. */
+  os_aio_batch_submit();
+
   /* In simulated aio we wake the aio handler threads only after
   queuing all aio requests. */
 
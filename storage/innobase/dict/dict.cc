@@ -121,5 +121,8 @@ void dict_index_add_col(dict_index_t *index, const dict_table_t *table,
 
   if (!(col->prtype & DATA_NOT_NULL)) {
     index->n_nullable++;
+  } else if (field->fixed_len > 0 &&
+             index->n_fixed_prefix == index->n_def - 1) {
+    index->n_fixed_prefix++;
   }
 }
@@ -1052,6 +1052,12 @@ void dict_move_to_mru(dict_table_t *table) /*!< in: table to move to MRU */
 
   ut_a(table->can_be_evicted);
 
+  /* A table opened repeatedly is usually already at the head; do not
+  touch its neighbours' list nodes while holding dict_sys->mutex. */
+  if (UT_LIST_GET_FIRST(dict_sys->table_LRU) == table) {
+    return;
+  }
+
   UT_LIST_REMOVE(dict_sys->table_LRU, table);
 
   UT_LIST_ADD_FIRST(dict_sys->table_LRU, table);
@@ -41,6 +41,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "dyn0buf.h"
 #include "ha_prototypes.h"
 #include "lob0lob.h"
+#include "os0thread-create.h"
 #include "pars0pars.h"
 #include "row0sel.h"
 #include "trx0trx.h"
@@ -2003,6 +2004,68 @@ static void dict_stats_analyze_index(
   }
 }
 
+/** Calculates new statistics for the given indexes of a table, using up to
+srv_stats_persistent_threads threads, the calling thread included. The
+indexes are sampled independently of each other, so a table with many indexes
+does not wait for them one by one. Each thread gets a nearly equal share.
+@param[in]	table		table the indexes belong to
+@param[in]	indexes		indexes to analyze */
+static void dict_stats_analyze_indexes(
+    const dict_table_t *table, const std::vector<dict_index_t *> &indexes) {
+  if (indexes.empty()) {
+    return;
+  }
+
+  const size_t n_threads =
+      std::min<size_t>(srv_stats_persistent_threads, indexes.size());
+
+  /* ut_rnd is seeded per thread, and a new thread would otherwise pick the
+  same leaf pages on every run. */
+  const ulint seed = ut_rnd_gen_ulint();
+
+  auto analyze = [table, seed](std::vector<dict_index_t *>::const_iterator b,
+                               std::vector<dict_index_t *>::const_iterator e,
+                               size_t thread_id) {
+    ut_rnd_ulint_counter = seed + thread_id;
+
+    for (auto it = b; it != e; ++it) {
+      if (!(table->stats_bg_flag & BG_STAT_SHOULD_QUIT)) {
+        dict_stats_analyze_index(*it);
+      }
+    }
+  };
+
+  if (n_threads == 1) {
+    analyze(indexes.begin(), indexes.end(), 0);
+    return;
+  }
+
+  /* Not par_for(): it gives the calling thread only the remainder of the
+  division, which may be nothing. Thread i takes the i-th of n_threads nearly
+  equal ranges, and the calling thread takes range 0. */
+  auto range_begin = [&indexes, n_threads](size_t i) {
+    return indexes.begin() + (indexes.size() * i) / n_threads;
+  };
+
+  std::vector<IB_thread> workers;
+
+  workers.reserve(n_threads - 1);
+
+  for (size_t i = 1; i < n_threads; ++i) {
+    auto worker = os_thread_create(PFS_NOT_INSTRUMENTED, analyze,
+                                   range_begin(i), range_begin(i + 1), i);
+    worker.start();
+
+    workers.push_back(std::move(worker));
+  }
+
+  analyze(range_begin(0), range_begin(1), 0);
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
 /** Calculates new estimates for table and index statistics. This function
  is relatively slow and is used to calculate persistent statistics that
  will be saved on disk.
@@ -2043,7 +2106,10 @@ static dberr_t dict_stats_update_persistent(
 
   table->stat_sum_of_other_index_sizes = 0;
 
-  for (index = index->next(); index != nullptr; index = index->next()) {
+  std::vector<dict_index_t *> indexes;
+  dict_index_t *const clust_index = index;
+
+  for (index = clust_index->next(); index != nullptr; index = index->next()) {
     ut_ad(!dict_index_is_ibuf(index));
 
     if (index->type & DICT_FTS || dict_index_is_spatial(index)) {
@@ -2052,12 +2118,16 @@ static dberr_t dict_stats_update_persistent(
 
     dict_stats_empty_index(index);
 
-    if (dict_stats_should_ignore_index(index)) {
-      continue;
+    if (!dict_stats_should_ignore_index(index)) {
+      indexes.push_back(index);
     }
+  }
 
-    if (!(table->stats_bg_flag & BG_STAT_SHOULD_QUIT)) {
-      dict_stats_analyze_index(index);
+  dict_stats_analyze_indexes(table, indexes);
+
+  for (index = clust_index->next(); index != nullptr; index = index->next()) {
+    if (index->type & DICT_FTS || dict_index_is_spatial(index)) {
+      continue;
     }
 
     table->stat_sum_of_other_index_sizes += index->stat_index_size;
@@ -2505,6 +2505,9 @@ fil_node_t *Fil_shard::create_node(const char *name, page_no_t size,
 
   space->size += size;
 
+  space->atomic_write =
+      atomic_write && (space->files.empty() || space->atomic_write);
+
   space->files.push_back(file);
 
   mutex_release();
@@ -5815,8 +5818,7 @@ dberr_t fil_ibd_open(bool validate, fil_type_t purpose, space_id_t space_id,
   }
 
 #if !defined(NO_FALLOCATE) && defined(UNIV_LINUX)
-  const bool atomic_write =
-      !dblwr::enabled && fil_fusionio_enable_atomic_write(df.handle());
+  const bool atomic_write = fil_fusionio_enable_atomic_write(df.handle());
 #else
   const bool atomic_write = false;
 #endif /* !NO_FALLOCATE && UNIV_LINUX */
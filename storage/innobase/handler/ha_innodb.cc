@@ -800,6 +800,7 @@ static PSI_thread_info all_innodb_threads[] = {
     PSI_KEY(log_flusher_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(log_write_notifier_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(log_flush_notifier_thread, 0, 0, PSI_DOCUMENT_ME),
+    PSI_KEY(recv_apply_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(recv_writer_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(srv_error_monitor_thread, 0, 0, PSI_DOCUMENT_ME),
     PSI_KEY(srv_lock_timeout_thread, 0, 0, PSI_DOCUMENT_ME),
@@ -1050,6 +1051,9 @@ static SHOW_VAR innodb_status_variables[] = {
      SHOW_SCOPE_GLOBAL},
     {"data_written", (char *)&export_vars.innodb_data_written, SHOW_LONG,
      SHOW_SCOPE_GLOBAL},
+    {"dblwr_atomic_bytes_saved",
+     (char *)&export_vars.innodb_dblwr_atomic_bytes_saved, SHOW_LONG,
+     SHOW_SCOPE_GLOBAL},
     {"dblwr_pages_written", (char *)&export_vars.innodb_dblwr_pages_written,
      SHOW_LONG, SHOW_SCOPE_GLOBAL},
     {"dblwr_writes", (char *)&export_vars.innodb_dblwr_writes, SHOW_LONG,
@@ -9745,11 +9749,48 @@ int ha_innobase::index_end(void) {
 
   in_range_check_pushed_down = FALSE;
 
+  m_range_scan_expected_rows = 0;
+
   m_ds_mrr.dsmrr_close();
 
   return 0;
 }
 
+/** Read ahead the leaf pages a forward range scan is expected to read.
+@param[in]	index		index to be scanned
+@param[in]	tuple		key the scan starts from
+@param[in]	expected_rows	rows the range optimizer expects the scan to
+                                read */
+static void innobase_prefetch_range(dict_index_t *index, const dtuple_t *tuple,
+                                    ha_rows expected_rows) {
+  if (index->table->is_temporary() || dict_index_is_spatial(index) ||
+      dict_index_is_online_ddl(index)) {
+    return;
+  }
+
+  /* The statistics are read without a latch; a stale value only makes the
+  estimate less accurate. */
+  const uint64_t n_rows = index->table->stat_n_rows;
+  const ulint n_leaf_pages = index->stat_n_leaf_pages;
+
+  if (n_rows == 0 || n_leaf_pages == 0) {
+    return;
+  }
+
+  const uint64_t rows_per_page = std::max<uint64_t>(1, n_rows / n_leaf_pages);
+  const uint64_t n_pages = expected_rows / rows_per_page;
+
+  /* A short range is read faster by the scan itself than with an extra
+  descent to the parent level. */
+  if (n_pages < BTR_CUR_PREFETCH_LEAVES_MIN) {
+    return;
+  }
+
+  btr_cur_prefetch_leaves(
+      index, tuple,
+      static_cast<ulint>(std::min<uint64_t>(n_pages, ULINT_MAX)));
+}
+
 /** Converts a search mode flag understood by MySQL to a flag understood
  by InnoDB. */
 page_cur_mode_t convert_search_mode_to_innobase(ha_rkey_function find_flag) {
@@ -9936,6 +9977,15 @@ int ha_innobase::index_read(
 
   m_last_match_mode = (uint)match_mode;
 
+  if (m_range_scan_expected_rows > 0) {
+    if (key_ptr != nullptr && (mode == PAGE_CUR_GE || mode == PAGE_CUR_G)) {
+      innobase_prefetch_range(index, m_prebuilt->search_tuple,
+                              m_range_scan_expected_rows);
+    }
+
+    m_range_scan_expected_rows = 0;
+  }
+
   dberr_t ret;
 
   if (mode != PAGE_CUR_UNSUPP) {
@@ -21643,6 +21693,13 @@ static MYSQL_SYSVAR_ULONGLONG(
     " statistics (by ANALYZE, default 20)",
     nullptr, nullptr, 20, 1, ~0ULL, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    stats_persistent_threads, srv_stats_persistent_threads,
+    PLUGIN_VAR_RQCMDARG,
+    "The number of threads that sample the secondary indexes of a table in"
+    " parallel when calculating persistent statistics (default 1)",
+    nullptr, nullptr, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_BOOL(
     adaptive_hash_index, btr_search_enabled, PLUGIN_VAR_OPCMDARG,
     "Enable InnoDB adaptive hash index (enabled by default). "
@@ -21957,6 +22014,13 @@ static MYSQL_SYSVAR_ULONG(write_io_threads, srv_n_write_io_threads,
                           "Number of background write I/O threads in InnoDB.",
                           nullptr, nullptr, 4, 1, 64, 0);
 
+static MYSQL_SYSVAR_ULONG(
+    redo_apply_threads, srv_n_recv_apply_threads,
+    PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+    "Number of threads applying redo log records to pages during crash"
+    " recovery.",
+    nullptr, nullptr, 4, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(force_recovery, srv_force_recovery,
                           PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
                           "Helps to save your data in case the disk image of "
@@ -22006,6 +22070,16 @@ static MYSQL_SYSVAR_ULONG(
     48 * 1024 * 1024L, 4 * 1024 * 1024L, ULLONG_MAX, 1024 * 1024L);
 #endif /* UNIV_DEBUG_DEDICATED */
 
+#ifndef _WIN32
+static MYSQL_SYSVAR_BOOL(
+    log_write_dsync, srv_log_write_dsync,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "With innodb_flush_log_at_trx_commit = 1, let the log writer write redo"
+    " with a single durable write (pwritev2 with RWF_DSYNC where available)"
+    " instead of waking the log flusher to fsync after each write.",
+    nullptr, nullptr, FALSE);
+#endif /* !_WIN32 */
+
 static MYSQL_SYSVAR_ULONG(log_write_ahead_size, srv_log_write_ahead_size,
                           PLUGIN_VAR_RQCMDARG,
                           "Log write ahead unit size to avoid read-on-write,"
@@ -22321,6 +22395,15 @@ static MYSQL_SYSVAR_BOOL(
     PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
     "Use NUMA interleave memory policy to allocate InnoDB buffer pool.",
     nullptr, nullptr, FALSE);
+
+static MYSQL_SYSVAR_BOOL(
+    numa_buffer_pool_bind, srv_numa_buffer_pool_bind,
+    PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+    "Assign the InnoDB buffer pool instances round-robin to NUMA nodes,"
+    " allocate the memory of each instance on its node, and run the page"
+    " cleaner threads on the nodes of the instances they flush. Ignored if"
+    " innodb_numa_interleave is set.",
+    nullptr, nullptr, FALSE);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_BOOL(
@@ -22632,6 +22715,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(api_disable_rowlock),
     MYSQL_SYSVAR(fast_shutdown),
     MYSQL_SYSVAR(read_io_threads),
+    MYSQL_SYSVAR(redo_apply_threads),
     MYSQL_SYSVAR(write_io_threads),
     MYSQL_SYSVAR(file_per_table),
     MYSQL_SYSVAR(flush_log_at_timeout),
@@ -22661,6 +22745,9 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(debug_sys_mem_size),
 #endif /* UNIV_DEBUG_DEDICATED */
     MYSQL_SYSVAR(log_write_ahead_size),
+#ifndef _WIN32
+    MYSQL_SYSVAR(log_write_dsync),
+#endif /* !_WIN32 */
     MYSQL_SYSVAR(log_group_home_dir),
     MYSQL_SYSVAR(log_writer_threads),
     MYSQL_SYSVAR(log_spin_cpu_abs_lwm),
@@ -22709,6 +22796,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(stats_transient_sample_pages),
     MYSQL_SYSVAR(stats_persistent),
     MYSQL_SYSVAR(stats_persistent_sample_pages),
+    MYSQL_SYSVAR(stats_persistent_threads),
     MYSQL_SYSVAR(stats_auto_recalc),
     MYSQL_SYSVAR(adaptive_hash_index),
     MYSQL_SYSVAR(adaptive_hash_index_parts),
@@ -22733,6 +22821,7 @@ static SYS_VAR *innobase_system_variables[] = {
     MYSQL_SYSVAR(use_native_aio),
 #ifdef HAVE_LIBNUMA
     MYSQL_SYSVAR(numa_interleave),
+    MYSQL_SYSVAR(numa_buffer_pool_bind),
 #endif /* HAVE_LIBNUMA */
     MYSQL_SYSVAR(change_buffering),
     MYSQL_SYSVAR(change_buffer_max_size),
@@ -22869,6 +22958,45 @@ int ha_innobase::multi_range_read_next(char **range_info) {
   return (m_ds_mrr.dsmrr_next(range_info));
 }
 
+void ha_innobase::read_ahead_positions(const uchar *first, const uchar *last,
+                                       size_t stride) {
+  ut_ad(stride >= ref_length);
+
+  dict_index_t *index = m_prebuilt->table->first_index();
+
+  /* A couple of rows are read sooner than we could read them ahead. */
+  if (index->table->is_temporary() ||
+      static_cast<size_t>(last - first) < 2 * stride) {
+    return;
+  }
+
+  mem_heap_t *heap = mem_heap_create(256);
+  const ulint n_fields = dict_index_get_n_fields(index);
+  dtuple_t *tuple = dtuple_create(heap, n_fields);
+  const ulint key_buf_len = m_prebuilt->srch_key_val_len;
+  byte *key_buf = static_cast<byte *>(mem_heap_alloc(heap, key_buf_len));
+
+  dict_index_copy_types(tuple, index, n_fields);
+
+  /* The references are sorted, so the same conversion that rnd_pos() does
+  gives the keys in ascending order. */
+  const uchar *pos = first;
+
+  btr_cur_prefetch_leaves_for_keys(index, [&]() -> const dtuple_t * {
+    if (pos >= last) {
+      return nullptr;
+    }
+
+    row_sel_convert_mysql_key_to_innobase(tuple, key_buf, key_buf_len, index,
+                                          pos, ref_length, m_prebuilt->trx);
+    pos += stride;
+
+    return tuple;
+  });
+
+  mem_heap_free(heap);
+}
+
 ha_rows ha_innobase::multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
                                                  void *seq_init_param,
                                                  uint n_ranges, uint *bufsz,
@@ -473,6 +473,18 @@ class ha_innobase : public handler {
   /** @name Multi Range Read interface
   @{ */
 
+  /** Remember the range optimizer estimate for the next index read, so that
+  it can read ahead the leaf pages of the range.
+  @see handler::set_range_scan_expected_rows */
+  void set_range_scan_expected_rows(ha_rows rows) override {
+    m_range_scan_expected_rows = rows;
+  }
+
+  /** Read ahead the clustered index leaf pages of the given rows.
+  @see handler::read_ahead_positions */
+  void read_ahead_positions(const uchar *first, const uchar *last,
+                            size_t stride) override;
+
   /** Initialize multi range read @see DsMrr_impl::dsmrr_init */
   int multi_range_read_init(RANGE_SEQ_IF *seq, void *seq_init_param,
                             uint n_ranges, uint mode,
@@ -678,6 +690,10 @@ class ha_innobase : public handler {
 
   /** If mysql has locked with external_lock() */
   bool m_mysql_has_locked;
+
+  /** Number of rows the next range scan is expected to read, or 0 if not
+  known. @see set_range_scan_expected_rows */
+  ha_rows m_range_scan_expected_rows{0};
 };
 
 struct trx_t;
@@ -416,6 +416,9 @@ class ha_innopart : public ha_innobase,
   ha_rows records_in_range(uint inx, key_range *min_key,
                            key_range *max_key) override;
 
+  /** Not supported: the row references span partitions. */
+  void read_ahead_positions(const uchar *, const uchar *, size_t) override {}
+
   ha_rows estimate_rows_upper_bound() override;
 
   uint alter_table_flags(uint flags);
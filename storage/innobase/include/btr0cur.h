@@ -36,6 +36,8 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #ifndef btr0cur_h
 #define btr0cur_h
 
+#include <functional>
+
 #include "btr0types.h"
 #include "dict0dict.h"
 #include "gis0type.h"
@@ -566,6 +568,39 @@ int64_t btr_estimate_n_rows_in_range(dict_index_t *index,
                                      const dtuple_t *tuple2,
                                      page_cur_mode_t mode2);
 
+/** Maximum number of leaf pages btr_cur_prefetch_leaves() reads ahead. */
+constexpr ulint BTR_CUR_PREFETCH_LEAVES_MAX = 256;
+
+/** Minimum number of leaf pages a range scan must be expected to read before
+btr_cur_prefetch_leaves() is worth its extra descent to the parent level. */
+constexpr ulint BTR_CUR_PREFETCH_LEAVES_MIN = 8;
+
+/** Starts asynchronous reads of the leaf pages following the one on which a
+forward scan from the given key starts, so that they are in the buffer pool by
+the time the scan gets to them. The page numbers are taken from the node
+pointers on the parent page of the first leaf, so at most the leaves under
+that parent page are read. Nothing is read if the index SX-latch is not
+immediately available. The caller must not hold any latches.
+@param[in]	index	index
+@param[in]	tuple	key the scan starts from
+@param[in]	n_pages	number of leaf pages to read ahead, at most
+                        BTR_CUR_PREFETCH_LEAVES_MAX
+@return number of pages read ahead */
+ulint btr_cur_prefetch_leaves(dict_index_t *index, const dtuple_t *tuple,
+                              ulint n_pages);
+
+/** Starts asynchronous reads of the leaf pages on which lookups of the given
+keys will land. The keys must come in ascending order; the parent page of the
+leaves is then searched once and walked along for all keys that fall under it,
+and each leaf is read once. The caller must not hold any latches.
+@param[in]	index		index
+@param[in]	next_key	returns the next key, or nullptr after the last
+                                one; a returned key must stay valid until the
+                                next call
+@return number of pages read ahead */
+ulint btr_cur_prefetch_leaves_for_keys(
+    dict_index_t *index, const std::function<const dtuple_t *()> &next_key);
+
 /** Estimates the number of different key values in a given index, for
  each n-column prefix of the index where 1 <= n <=
  dict_index_get_n_unique(index). The estimates are stored in the array
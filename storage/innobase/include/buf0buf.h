@@ -2221,6 +2221,10 @@ struct buf_pool_t {
   /** Array index of this buffer pool instance */
   ulint instance_no;
 
+  /** NUMA node on which the memory of this instance is allocated, or -1 if
+  innodb_numa_buffer_pool_bind is not in effect */
+  int numa_node;
+
   /** Current pool size in bytes */
   ulint curr_pool_size;
 
@@ -2341,6 +2345,16 @@ struct buf_pool_t {
   batch from the buffer pool. Accessed protected by memory barriers. */
   bool try_LRU_scan;
 
+  /** Number of times buf_LRU_get_free_block() found the free list empty
+  since the last LRU batch of this instance. */
+  std::atomic<ulint> n_free_list_misses;
+
+  /** Number of free blocks an LRU batch tries to keep in the free list. It
+  is raised above innodb_lru_scan_depth while threads keep finding the free
+  list empty and decays back when they stop. Only accessed by the page
+  cleaner thread flushing this instance. */
+  ulint LRU_free_target;
+
   /** Page Tracking start LSN. */
   lsn_t track_page_lsn;
 
@@ -943,6 +943,11 @@ struct dict_index_t {
   /*!< number of nullable fields before first
   instant ADD COLUMN applied to this table.
   This is valid only when has_instant_cols() is true */
+  unsigned n_fixed_prefix : 10;
+  /*!< number of fields from the beginning which
+  are NOT NULL and of fixed length, so that their
+  offsets are the same in every ROW_FORMAT=COMPACT
+  record; maintained by dict_index_add_col() */
   unsigned cached : 1; /*!< TRUE if the index object is in the
                       dictionary cache */
   unsigned to_be_dropped : 1;
@@ -491,6 +491,11 @@ struct fil_space_t {
   /** true if this space is currently in unflushed_spaces */
   bool is_in_unflushed_spaces{};
 
+  /** true if atomic writes are enabled for every file of this tablespace.
+  Pages of such a tablespace cannot be torn, so they are written without
+  going through the doublewrite buffer. */
+  bool atomic_write{};
+
   /** Compression algorithm */
   Compression::Type compression_type;
 
@@ -311,7 +311,11 @@ class IORequest {
     /** We optimise cases where punch hole is not done if the compressed length
     of the page is the same as the original size of the page. Ignore such
     optimisations if this flag is set. */
-    DISABLE_PUNCH_HOLE_OPTIMISATION = 2048
+    DISABLE_PUNCH_HOLE_OPTIMISATION = 2048,
+
+    /** The written data must be durable when the write returns, as if the
+    write was followed by fdatasync(). Only for synchronous writes. */
+    DSYNC = 4096
   };
 
   /** Default constructor */
@@ -394,6 +398,11 @@ class IORequest {
     return ((m_type & PUNCH_HOLE) == PUNCH_HOLE);
   }
 
+  /** @return true if the write must be durable when it returns */
+  bool is_dsync() const MY_ATTRIBUTE((warn_unused_result)) {
+    return ((m_type & DSYNC) == DSYNC);
+  }
+
   /** @return true if punch hole needs to be done always if it's supported and
   if the page is to be compressed. */
   bool is_punch_hole_optimisation_disabled() const
@@ -1701,6 +1710,17 @@ call os_aio_simulated_wake_handler_threads later to ensure the threads
 are not left sleeping! */
 void os_aio_simulated_put_read_threads_to_sleep();
 
+/** Start collecting the native AIO requests that the calling thread posts
+instead of handing each one to the kernel as it is posted. The caller must
+call os_aio_batch_submit() before it waits for any of these requests to
+complete. If the thread runs out of AIO slots, the requests collected so far
+are submitted early. This is a no-op unless Linux native AIO is used. */
+void os_aio_batch_start();
+
+/** Hand the native AIO requests collected since os_aio_batch_start() to the
+kernel, with one io_submit() call per io_context, and stop collecting. */
+void os_aio_batch_submit();
+
 /** Waits for an AIO operation to complete. This function is used to wait the
 for completed requests. The AIO array of pending requests is divided
 into segments. The thread specifies which segment or slot it wants to wait
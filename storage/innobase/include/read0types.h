@@ -300,6 +300,9 @@ class ReadView {
   they can be removed in purge if not needed by other views */
   trx_id_t m_low_limit_no;
 
+  /** trx_sys->n_rw_trx_ids_removed when this snapshot was taken */
+  uint64_t m_n_rw_trx_ids_removed;
+
 #ifdef UNIV_DEBUG
   /** The low limit number up to which read views don't need to access
   undo log records for MVCC. This could be higher than m_low_limit_no
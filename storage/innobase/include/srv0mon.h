@@ -323,6 +323,7 @@ enum monitor_id_t {
   MONITOR_N_UPD_EXIST_EXTERN,
   MONITOR_PURGE_INVOKED,
   MONITOR_PURGE_N_PAGE_HANDLED,
+  MONITOR_PURGE_N_PAGE_PREFETCHED,
   MONITOR_DML_PURGE_DELAY,
   MONITOR_PURGE_STOP_COUNT,
   MONITOR_PURGE_RESUME_COUNT,
@@ -100,6 +100,10 @@ struct srv_stats_t {
   doublewrite buffer */
   ulint_ctr_1_t dblwr_pages_written;
 
+  /** Store the number of bytes that were not written to the doublewrite
+  buffer because the tablespace has atomic writes */
+  ulint_ctr_1_t dblwr_atomic_bytes_saved;
+
   /** Store the number of write requests issued */
   ulint_ctr_1_t buf_pool_write_requests;
 
@@ -388,6 +392,9 @@ use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 extern bool srv_use_native_aio;
 extern bool srv_numa_interleave;
+/** Place each buffer pool instance, and a page cleaner thread serving it, on
+one NUMA node (innodb_numa_buffer_pool_bind). */
+extern bool srv_numa_buffer_pool_bind;
 
 /* The innodb_directories variable value. This a list of directories
 deliminated by ';', i.e the FIL_PATH_SEPARATOR. */
@@ -460,6 +467,11 @@ extern ulong srv_log_write_max_size;
 /** Size of block, used for writing ahead to avoid read-on-write. */
 extern ulong srv_log_write_ahead_size;
 
+/** If true, with innodb_flush_log_at_trx_commit = 1 the log writer writes
+redo with IORequest::DSYNC and advances the flushed lsn itself, instead of
+handing over to the log flusher for a separate fsync. */
+extern bool srv_log_write_dsync;
+
 /** Number of events used for notifications about redo write. */
 extern ulong srv_log_write_events;
 
@@ -609,6 +621,8 @@ extern bool srv_random_read_ahead;
 extern ulong srv_read_ahead_threshold;
 extern ulong srv_n_read_io_threads;
 extern ulong srv_n_write_io_threads;
+/** Number of threads applying hashed redo log records during recovery */
+extern ulong srv_n_recv_apply_threads;
 
 extern uint srv_change_buffer_max_size;
 
@@ -671,6 +685,9 @@ extern ibool srv_innodb_status;
 extern unsigned long long srv_stats_transient_sample_pages;
 extern bool srv_stats_persistent;
 extern unsigned long long srv_stats_persistent_sample_pages;
+/** Number of threads that sample the indexes of one table when calculating
+persistent statistics */
+extern ulong srv_stats_persistent_threads;
 extern bool srv_stats_auto_recalc;
 extern bool srv_stats_include_delete_marked;
 
@@ -774,6 +791,7 @@ extern mysql_pfs_key_t log_write_notifier_thread_key;
 extern mysql_pfs_key_t log_flush_notifier_thread_key;
 extern mysql_pfs_key_t page_flush_coordinator_thread_key;
 extern mysql_pfs_key_t page_flush_thread_key;
+extern mysql_pfs_key_t recv_apply_thread_key;
 extern mysql_pfs_key_t recv_writer_thread_key;
 extern mysql_pfs_key_t srv_error_monitor_thread_key;
 extern mysql_pfs_key_t srv_lock_timeout_thread_key;
@@ -1130,6 +1148,7 @@ struct export_var_t {
   ulint innodb_buffer_pool_read_ahead_rnd; /*!< srv_read_ahead_rnd */
   ulint innodb_buffer_pool_read_ahead;     /*!< srv_read_ahead */
   ulint innodb_buffer_pool_read_ahead_evicted; /*!< srv_read_ahead evicted*/
+  ulint innodb_dblwr_atomic_bytes_saved;   /*!< srv_dblwr_atomic_bytes_saved */
   ulint innodb_dblwr_pages_written;            /*!< srv_dblwr_pages_written */
   ulint innodb_dblwr_writes;                   /*!< srv_dblwr_writes */
   ulint innodb_log_waits;                      /*!< srv_log_waits */
@@ -453,6 +453,11 @@ struct trx_sys_t {
   std::atomic<trx_id_t> min_active_id;
   /*!< Minimal transaction id which is
   still in active state. */
+
+  /** Number of ids removed from rw_trx_ids so far. Incremented while
+  holding the mutex. Lets MVCC::view_open() reuse a closed read view
+  without the mutex when no transaction in it has committed since. */
+  std::atomic<uint64_t> n_rw_trx_ids_removed;
   trx_ut_list_t serialisation_list;
   /*!< Ordered on trx_t::no of all the
   currenrtly active RW transactions */
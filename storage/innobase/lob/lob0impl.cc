@@ -25,6 +25,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 *****************************************************************************/
 
 #include "lob0impl.h"
+#include "buf0rea.h"
 #include "lob0del.h"
 #include "lob0index.h"
 #include "lob0inf.h"
@@ -1167,12 +1168,59 @@ ulint read(ReadContext *ctx, ref_t ref, ulint offset, ulint len, byte *buf) {
   const ulint commit_freq = 10;
   ulint data_pages_count = 0;
 
+  /* For a LOB spanning several data pages, keep asynchronous reads requested
+  for the data pages of up to read_ahead_pages index entries, so that the
+  pages are not fetched one synchronous read at a time. The window ends where
+  the entries cover the bytes still wanted. Entries of a newer LOB version
+  than ours are not read ahead, since we read one of their older versions,
+  and those are simply read on demand. */
+  const ulint read_ahead_pages = 32;
+  const bool read_ahead = want > 4 * ctx->m_page_size.physical();
+  index_entry_t ahead_entry(&mtr, ctx->m_index);
+  fil_addr_t ahead_loc = node_loc;
+  ulint n_ahead = 0;
+  /* Number of data bytes in the n_ahead entries. */
+  ulint ahead_len = 0;
+
   while (!fil_addr_is_null(node_loc) && want > 0) {
     old_version.reset(nullptr);
 
+    if (read_ahead) {
+      ulint n_requested = 0;
+
+      while (n_ahead < read_ahead_pages && ahead_len < want + page_offset &&
+             !fil_addr_is_null(ahead_loc)) {
+        ahead_entry.reset(
+            first_page.addr2ptr_s_cache(cached_blocks, ahead_loc));
+
+        const page_no_t ahead_page_no = ahead_entry.get_page_no();
+
+        if (ahead_page_no != FIL_NULL && ahead_page_no != first_page_no &&
+            ahead_entry.get_lob_version() <= lob_version) {
+          n_requested += buf_read_page_background(
+              page_id_t(ctx->m_space_id, ahead_page_no), ctx->m_page_size,
+              false);
+        }
+
+        ahead_len += ahead_entry.get_data_len();
+        ahead_loc = ahead_entry.get_next();
+        ++n_ahead;
+      }
+
+      if (n_requested > 0) {
+        os_aio_simulated_wake_handler_threads();
+      }
+    }
+
     node = first_page.addr2ptr_s_cache(cached_blocks, node_loc);
     cur_entry.reset(node);
 
+    if (read_ahead && n_ahead > 0) {
+      /* The current entry is consumed by this iteration. */
+      --n_ahead;
+      ahead_len -= std::min(ahead_len, cur_entry.get_data_len());
+    }
+
     cur_entry.read(entry_mem);
 
     const uint32_t entry_lob_version = cur_entry.get_lob_version();
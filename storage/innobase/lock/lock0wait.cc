@@ -490,6 +490,15 @@ static void lock_wait_check_and_cancel(
   if (trx_is_interrupted(trx) ||
       (slot->wait_timeout < 100000000 &&
        (wait_time > (int64_t)slot->wait_timeout || wait_time < 0))) {
+    /* The trx is still in its slot, so it can be accessed. If its wait has
+    already ended, but the trx has not released the slot yet, there is nothing
+    to cancel, and we can save ourselves the exclusive global latch, which
+    stops all other lock_sys activity for a while. A stale non-null value is
+    fine, because we check trx->lock.wait_lock again under the latch. */
+    if (trx->lock.blocking_trx.load() == nullptr) {
+      return;
+    }
+
     /* Timeout exceeded or a wrap-around in system time counter: cancel the lock
     request queued by the transaction and release possible other transactions
     waiting behind; it is possible that the lock has already been granted: in
@@ -1027,6 +1036,32 @@ static bool lock_wait_trxs_are_still_in_slots(
   return true;
 }
 
+/** Given an array with information about all waiting transactions and indexes
+in it which form a deadlock cycle, checks if each of the transactions still
+waits for the transaction it waited for when the snapshot was taken. This needs
+no lock_sys latch, as trx->lock.blocking_trx may be read without latches and
+the transactions are known to still be in their slots. A changed edge means
+the cycle has already been broken, so it is not worth taking the exclusive
+global latch to verify it. If a new cycle has formed meanwhile, it will be
+found in the next snapshot.
+@param[in]    cycle_ids   indexes in `infos` array, of transactions forming the
+                          deadlock cycle
+@param[in]    infos       information about all waiting transactions
+@return true if all edges of the cycle are still present */
+static bool lock_wait_trxs_still_wait_for_same_trxs(
+    const ut::vector<uint> &cycle_ids,
+    const ut::vector<waiting_trx_info_t> &infos) {
+  ut_ad(lock_wait_mutex_own());
+
+  for (auto id : cycle_ids) {
+    const auto &info = infos[id];
+    if (info.trx->lock.blocking_trx.load() != info.waits_for) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /** Given an array with information about all waiting transactions and indexes
 in it which form a deadlock cycle, checks if the transactions allegedly forming
 the deadlock have actually still wait for a lock, as opposed to being already
@@ -1226,7 +1261,8 @@ static bool lock_wait_check_candidate_cycle(
   So, we start by first checking that the slots still contain the trxs we are
   interested in. This requires lock_wait_mutex, but does not require the
   exclusive global latch. */
-  if (!lock_wait_trxs_are_still_in_slots(cycle_ids, infos)) {
+  if (!lock_wait_trxs_are_still_in_slots(cycle_ids, infos) ||
+      !lock_wait_trxs_still_wait_for_same_trxs(cycle_ids, infos)) {
     lock_wait_mutex_exit();
     return false;
   }
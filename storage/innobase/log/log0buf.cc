@@ -1024,6 +1024,21 @@ lsn_t log_buffer_write(log_t &log, const Log_handle &handle, const byte *str,
   return (lsn);
 }
 
+/** Waits before re-checking for a free slot in recent_written or
+recent_closed. The slot is usually freed within microseconds by the log
+writer or the log closer, so spin for the first srv_n_spin_wait_rounds
+rounds and only then fall back to sleeping.
+@param[in]	wait_loops	number of rounds already waited */
+static inline void log_buffer_wait_for_link_buf(uint64_t wait_loops) {
+  if (wait_loops < srv_n_spin_wait_rounds) {
+    if (srv_spin_wait_delay) {
+      ut_delay(ut_rnd_interval(0, srv_spin_wait_delay));
+    }
+  } else {
+    std::this_thread::sleep_for(std::chrono::microseconds(20));
+  }
+}
+
 void log_buffer_write_completed(log_t &log, const Log_handle &handle,
                                 lsn_t start_lsn, lsn_t end_lsn) {
   ut_ad(rw_lock_own(log.sn_lock_inst, RW_LOCK_S));
@@ -1044,8 +1059,7 @@ void log_buffer_write_completed(log_t &log, const Log_handle &handle,
 
   while (!log.recent_written.has_space(start_lsn)) {
     os_event_set(log.writer_event);
-    ++wait_loops;
-    std::this_thread::sleep_for(std::chrono::microseconds(20));
+    log_buffer_wait_for_link_buf(wait_loops++);
   }
 
   if (unlikely(wait_loops != 0)) {
@@ -1097,8 +1111,7 @@ void log_wait_for_space_in_log_recent_closed(log_t &log, lsn_t lsn) {
   uint64_t wait_loops = 0;
 
   while (!log.recent_closed.has_space(lsn)) {
-    ++wait_loops;
-    std::this_thread::sleep_for(std::chrono::microseconds(20));
+    log_buffer_wait_for_link_buf(wait_loops++);
   }
 
   if (unlikely(wait_loops != 0)) {
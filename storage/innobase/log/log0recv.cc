@@ -36,11 +36,14 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <my_aes.h>
 #include <sys/types.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <iomanip>
 #include <map>
 #include <new>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "arch0arch.h"
@@ -198,6 +201,10 @@ is bigger than the lsn we are able to scan up to, that is an indication that
 the recovery failed and the database may be corrupt. */
 static lsn_t recv_max_page_lsn;
 
+#ifdef UNIV_PFS_THREAD
+mysql_pfs_key_t recv_apply_thread_key;
+#endif /* UNIV_PFS_THREAD */
+
 #ifndef UNIV_HOTBACKUP
 #ifdef UNIV_PFS_THREAD
 mysql_pfs_key_t recv_writer_thread_key;
@@ -1211,6 +1218,130 @@ static void recv_apply_log_rec(recv_addr_t *recv_addr) {
   }
 }
 
+/** Number of neighbouring pages that a recovery apply thread claims at a
+time. Same as the read-ahead area, so that the pages read in together by
+recv_read_in_area() are mostly handled by the same thread. */
+static const size_t RECV_APPLY_BATCH_SIZE = RECV_READ_AHEAD_AREA;
+
+/** Pages claimed and applied by the recovery apply threads. */
+class Recv_apply_progress {
+ public:
+  /** @param[in]	n_pages		number of pages to apply log records to */
+  explicit Recv_apply_progress(size_t n_pages)
+      : m_n_pages(n_pages), m_start_time(ut_time_monotonic()) {
+    m_unit = n_pages / PCT;
+
+    if (m_unit <= PCT) {
+      m_pct = 100;
+      m_unit = n_pages;
+    }
+
+    m_next_report = std::max<size_t>(1, m_unit);
+    m_unit = m_next_report;
+  }
+
+  /** Claim the next batch of pages.
+  @param[out]	begin	first page of the batch
+  @param[out]	end	one past the last page of the batch
+  @return false if all pages have been claimed */
+  bool claim(size_t *begin, size_t *end) {
+    *begin = m_next.fetch_add(RECV_APPLY_BATCH_SIZE);
+
+    if (*begin >= m_n_pages) {
+      return (false);
+    }
+
+    *end = std::min(*begin + RECV_APPLY_BATCH_SIZE, m_n_pages);
+
+    return (true);
+  }
+
+  /** Note that pages have been processed.
+  @param[in]	n	number of pages */
+  void applied(size_t n) { m_applied.fetch_add(n); }
+
+  /** Print the progress, if enough pages have been processed or enough
+  time has passed since it was last printed. Must only be called by one
+  thread. */
+  void report() {
+    const size_t applied = m_applied.load();
+
+    if (applied >= m_next_report) {
+      do {
+        ib::info(ER_IB_MSG_708) << m_pct << "%";
+
+        m_pct += PCT;
+        m_next_report += m_unit;
+      } while (applied >= m_next_report);
+
+      m_start_time = ut_time_monotonic();
+
+    } else if (ut_time_monotonic() - m_start_time >= PRINT_INTERVAL_SECS) {
+      m_start_time = ut_time_monotonic();
+
+      ib::info(ER_IB_MSG_709)
+          << std::setprecision(2)
+          << ((double)applied * 100) / (double)m_n_pages << "%";
+    }
+  }
+
+ private:
+  /** Print the progress in steps of this many percent. */
+  static const size_t PCT = 10;
+
+  /** Total number of pages */
+  const size_t m_n_pages;
+
+  /** Next page to be claimed */
+  std::atomic<size_t> m_next{0};
+
+  /** Number of pages processed */
+  std::atomic<size_t> m_applied{0};
+
+  /** Next percentage to print */
+  size_t m_pct{PCT};
+
+  /** Number of pages per PCT percent */
+  size_t m_unit;
+
+  /** Number of processed pages at which to print m_pct */
+  size_t m_next_report;
+
+  /** When the progress was last printed */
+  ib_time_monotonic_t m_start_time;
+};
+
+/** Apply log records to pages, until all pages have been claimed.
+recv_apply_log_rec() is safe to run in several threads: each page is only
+claimed by one of them, and the state of a page is checked and changed under
+recv_sys->mutex, as it is for pages that the I/O threads apply log records
+to after reading them in.
+@param[in]	recv_addrs	pages to apply log records to
+@param[in,out]	progress	pages claimed and processed so far
+@param[in]	report		whether this thread prints the progress */
+static void recv_apply_log_recs_thread(
+    const std::vector<recv_addr_t *> *recv_addrs,
+    Recv_apply_progress *progress, bool report) {
+  size_t begin;
+  size_t end;
+
+  mutex_enter(&recv_sys->mutex);
+
+  while (progress->claim(&begin, &end)) {
+    for (size_t i = begin; i < end; ++i) {
+      recv_apply_log_rec((*recv_addrs)[i]);
+    }
+
+    progress->applied(end - begin);
+
+    if (report) {
+      progress->report();
+    }
+  }
+
+  mutex_exit(&recv_sys->mutex);
+}
+
 /** Empties the hash table of stored log records, applying them to appropriate
 pages.
 @param[in,out]	log		Redo log
@@ -1246,18 +1377,13 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
 
   ib::info(ER_IB_MSG_707, ulonglong{batch_size});
 
-  static const size_t PCT = 10;
-
-  size_t pct = PCT;
-  size_t applied = 0;
-  auto unit = batch_size / PCT;
-
-  if (unit <= PCT) {
-    pct = 100;
-    unit = batch_size;
-  }
+  /* Collect the pages first, so that they can be handed out to the apply
+  threads in batches. The pages of a space are kept in a hash table, so
+  they are sorted: a batch then holds neighbouring pages, which keeps the
+  read-ahead in recv_read_in_area() within one thread. */
+  std::vector<recv_addr_t *> recv_addrs;
 
-  auto start_time = ut_time_monotonic();
+  recv_addrs.reserve(batch_size);
 
   for (const auto &space : *recv_sys->spaces) {
     bool dropped;
@@ -1283,27 +1409,48 @@ void recv_apply_hashed_log_recs(log_t &log, bool allow_ibuf) {
         pages.second->state = RECV_DISCARDED;
       }
 
-      recv_apply_log_rec(pages.second);
+      recv_addrs.push_back(pages.second);
+    }
+  }
 
-      ++applied;
+  std::sort(recv_addrs.begin(), recv_addrs.end(),
+            [](const recv_addr_t *lhs, const recv_addr_t *rhs) {
+              return (lhs->space < rhs->space ||
+                      (lhs->space == rhs->space &&
+                       lhs->page_no < rhs->page_no));
+            });
 
-      if (unit == 0 || (applied % unit) == 0) {
-        ib::info(ER_IB_MSG_708) << pct << "%";
+  /* The apply threads acquire recv_sys->mutex themselves. */
+  mutex_exit(&recv_sys->mutex);
 
-        pct += PCT;
+  Recv_apply_progress progress(recv_addrs.size());
 
-        start_time = ut_time_monotonic();
+  const size_t n_threads = std::min<size_t>(
+      srv_n_recv_apply_threads,
+      std::max<size_t>(1, recv_addrs.size() / RECV_APPLY_BATCH_SIZE));
 
-      } else if (ut_time_monotonic() - start_time >= PRINT_INTERVAL_SECS) {
-        start_time = ut_time_monotonic();
+  std::vector<IB_thread> threads;
 
-        ib::info(ER_IB_MSG_709)
-            << std::setprecision(2)
-            << ((double)applied * 100) / (double)batch_size << "%";
-      }
-    }
+  threads.reserve(n_threads);
+
+  for (size_t i = 1; i < n_threads; ++i) {
+    auto thread = os_thread_create(recv_apply_thread_key,
+                                   recv_apply_log_recs_thread, &recv_addrs,
+                                   &progress, false);
+    thread.start();
+
+    threads.push_back(std::move(thread));
   }
 
+  /* This thread applies log records too, and reports the progress. */
+  recv_apply_log_recs_thread(&recv_addrs, &progress, true);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  mutex_enter(&recv_sys->mutex);
+
   /* Wait until all the pages have been processed */
 
   while (recv_sys->n_addrs != 0) {
@@ -1436,6 +1436,12 @@ static void start_next_file(log_t &log, lsn_t start_lsn) {
   uint32_t nth_file = static_cast<uint32_t>(real_offset / log.file_size);
   log_files_header_flush(log, nth_file, start_lsn);
 
+  if (srv_log_write_dsync) {
+    /* The log writer may advance log.flushed_to_disk_lsn over redo in the
+    new file without the log flusher, so the header must be durable first. */
+    fil_flush_file_redo();
+  }
+
   /* Update following members of log:
   - current_file_lsn,
   - current_file_real_offset,
@@ -1675,7 +1681,7 @@ static inline void prepare_full_blocks(const log_t &log, byte *buffer,
 }
 
 static inline void write_blocks(log_t &log, byte *write_buf, size_t write_size,
-                                uint64_t real_offset) {
+                                uint64_t real_offset, bool dsync) {
   ut_a(write_size >= OS_FILE_LOG_BLOCK_SIZE);
   ut_a(write_size % OS_FILE_LOG_BLOCK_SIZE == 0);
   ut_a(real_offset / UNIV_PAGE_SIZE <= PAGE_NO_MAX);
@@ -1691,7 +1697,9 @@ static inline void write_blocks(log_t &log, byte *write_buf, size_t write_size,
 
   /* 进行 redo log 的文件写入. */
   auto err = fil_redo_io(
-      IORequestLogWrite, page_id_t{log.files_space_id, page_no}, univ_page_size,
+      dsync ? IORequest(IORequest::LOG | IORequest::WRITE | IORequest::DSYNC)
+            : IORequestLogWrite,
+      page_id_t{log.files_space_id, page_no}, univ_page_size,
       static_cast<ulint>(real_offset % UNIV_PAGE_SIZE), write_size, write_buf);
 
   meb::redo_log_archive_produce(write_buf, write_size);
@@ -1699,6 +1707,44 @@ static inline void write_blocks(log_t &log, byte *write_buf, size_t write_size,
   ut_a(err == DB_SUCCESS);
 }
 
+/** @return true if the log writer writes redo with IORequest::DSYNC, in which
+case it advances log.flushed_to_disk_lsn itself (innodb_log_write_dsync) */
+static inline bool log_writer_uses_dsync() {
+#ifndef _WIN32
+  return (srv_log_write_dsync && srv_flush_log_at_trx_commit == 1 &&
+          srv_unix_file_flush_method != SRV_UNIX_O_DSYNC);
+#else
+  return (false);
+#endif /* !_WIN32 */
+}
+
+static void notify_about_advanced_flushed_lsn(log_t &log,
+                                              lsn_t old_flushed_lsn,
+                                              lsn_t new_flushed_lsn);
+
+/** Advance log.flushed_to_disk_lsn after a write done with IORequest::DSYNC,
+unless the log flusher is busy (it then covers the write with its next
+fsync), or some redo before the write might not be durable yet.
+@param[in,out]	log		redo log
+@param[in]	old_write_lsn	log.write_lsn before the write
+@param[in]	new_write_lsn	log.write_lsn after the write */
+static void log_writer_advance_flushed_lsn(log_t &log, lsn_t old_write_lsn,
+                                           lsn_t new_write_lsn) {
+  if (log_flusher_mutex_enter_nowait(log)) {
+    return;
+  }
+
+  if (log.flushed_to_disk_lsn.load() == old_write_lsn) {
+    LOG_SYNC_POINT("log_flush_before_flushed_to_disk_lsn");
+
+    log.flushed_to_disk_lsn.store(new_write_lsn);
+
+    notify_about_advanced_flushed_lsn(log, old_write_lsn, new_write_lsn);
+  }
+
+  log_flusher_mutex_exit(log);
+}
+
 static inline void notify_about_advanced_write_lsn(log_t &log,
                                                    lsn_t old_write_lsn,
                                                    lsn_t new_write_lsn) {
@@ -1910,10 +1956,12 @@ static void log_files_write_buffer(log_t &log, byte *buffer, size_t buffer_size,
 
   srv_stats.os_log_pending_writes.inc();
 
+  const bool dsync = log_writer_uses_dsync();
+
   /* Now, we know, that we are going to write completed
   blocks only (originally or copied and completed). */
   /* 进行 redo log 的文件写入. */
-  write_blocks(log, write_buf, write_size, real_offset);
+  write_blocks(log, write_buf, write_size, real_offset, dsync);
 
   LOG_SYNC_POINT("log_writer_before_lsn_update");
 
@@ -1925,6 +1973,10 @@ static void log_files_write_buffer(log_t &log, byte *buffer, size_t buffer_size,
   /* 更新 log.write_lsn. */
   log.write_lsn.store(new_write_lsn);
 
+  if (dsync) {
+    log_writer_advance_flushed_lsn(log, old_write_lsn, new_write_lsn);
+  }
+
   notify_about_advanced_write_lsn(log, old_write_lsn, new_write_lsn);
 
   LOG_SYNC_POINT("log_writer_before_buf_limit_update");
@@ -2391,6 +2443,33 @@ static void log_flush_update_stats(log_t &log) {
   }
 }
 
+static void notify_about_advanced_flushed_lsn(log_t &log,
+                                              lsn_t old_flushed_lsn,
+                                              lsn_t new_flushed_lsn) {
+  ut_ad(log_flusher_mutex_own(log));
+
+  DBUG_PRINT("ib_log", ("Flushed to disk up to " LSN_PF, new_flushed_lsn));
+
+  if (!log.writer_threads_paused.load(std::memory_order_acquire)) {
+    const auto first_slot =
+        log_compute_flush_event_slot(log, old_flushed_lsn + 1);
+
+    const auto last_slot = log_compute_flush_event_slot(log, new_flushed_lsn);
+
+    if (first_slot == last_slot) {
+      LOG_SYNC_POINT("log_flush_before_users_notify");
+      os_event_set(log.flush_events[first_slot]);
+    } else {
+      LOG_SYNC_POINT("log_flush_before_notifier_notify");
+      os_event_set(log.flush_notifier_event);
+    }
+  } else {
+    LOG_SYNC_POINT("log_flush_before_users_notify");
+    LOG_SYNC_POINT("log_flush_before_notifier_notify");
+    os_event_set(log.old_flush_event);
+  }
+}
+
 static void log_flush_low(log_t &log) {
   ut_ad(log_flusher_mutex_own(log));
 
@@ -2440,26 +2519,7 @@ static void log_flush_low(log_t &log) {
 
   /* Notify other thread(s). */
 
-  DBUG_PRINT("ib_log", ("Flushed to disk up to " LSN_PF, flush_up_to_lsn));
-
-  if (!log.writer_threads_paused.load(std::memory_order_acquire)) {
-    const auto first_slot =
-        log_compute_flush_event_slot(log, last_flush_lsn + 1);
-
-    const auto last_slot = log_compute_flush_event_slot(log, flush_up_to_lsn);
-
-    if (first_slot == last_slot) {
-      LOG_SYNC_POINT("log_flush_before_users_notify");
-      os_event_set(log.flush_events[first_slot]);
-    } else {
-      LOG_SYNC_POINT("log_flush_before_notifier_notify");
-      os_event_set(log.flush_notifier_event);
-    }
-  } else {
-    LOG_SYNC_POINT("log_flush_before_users_notify");
-    LOG_SYNC_POINT("log_flush_before_notifier_notify");
-    os_event_set(log.old_flush_event);
-  }
+  notify_about_advanced_flushed_lsn(log, last_flush_lsn, flush_up_to_lsn);
 
   /* Update stats. */
 
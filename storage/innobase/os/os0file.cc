@@ -66,6 +66,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #ifdef __linux__
 #include <sys/sendfile.h>
+#include <sys/uio.h>
 #endif /* __linux__ */
 
 #ifdef LINUX_NATIVE_AIO
@@ -90,6 +91,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA
 
 #include <sys/types.h>
 #include <zlib.h>
+#include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <functional>
 #include <new>
@@ -513,6 +516,15 @@ class AIO {
   @return true on success. */
   bool linux_dispatch(Slot *slot) MY_ATTRIBUTE((warn_unused_result));
 
+  /** Queue an AIO request in the batch of the calling thread instead of
+  dispatching it, see os_aio_batch_start().
+  @param[in,out]	slot	an already reserved slot */
+  void linux_defer(Slot *slot);
+
+  /** Dispatch the AIO requests queued by linux_defer() in the calling
+  thread, with one io_submit() call per io_context. */
+  static void linux_submit_batch();
+
   /** Accessor for an AIO event
   @param[in]	index	Index into the array
   @return the event at the index */
@@ -2074,6 +2086,46 @@ static file::Block *os_file_encrypt_log(const IORequest &type, void *&buf,
 
 #ifndef _WIN32
 
+/** Write to a file so that the data is durable when the call returns, as with
+pwrite() followed by a sync. On Linux this is a single pwritev2() call with
+RWF_DSYNC, if the kernel supports it.
+@param[in]	fh	file handle
+@param[in]	buf	data to write
+@param[in]	n	number of bytes to write
+@param[in]	offset	file offset
+@return number of bytes written, or -1 with errno set */
+static ssize_t os_file_pwrite_dsync(os_file_t fh, const void *buf, size_t n,
+                                    os_offset_t offset) {
+#if defined(UNIV_LINUX) && defined(RWF_DSYNC)
+  static std::atomic<bool> pwritev2_dsync_supported{true};
+
+  if (pwritev2_dsync_supported.load(std::memory_order_relaxed)) {
+    struct iovec iov;
+
+    iov.iov_base = const_cast<void *>(buf);
+    iov.iov_len = n;
+
+    const ssize_t n_bytes = pwritev2(fh, &iov, 1, offset, RWF_DSYNC);
+
+    if (n_bytes >= 0 ||
+        (errno != ENOSYS && errno != EOPNOTSUPP && errno != EINVAL)) {
+      return (n_bytes);
+    }
+
+    /* Kernel older than 4.7, fall back to a separate sync. */
+    pwritev2_dsync_supported.store(false, std::memory_order_relaxed);
+  }
+#endif /* UNIV_LINUX && RWF_DSYNC */
+
+  const ssize_t n_bytes = pwrite(fh, buf, n, offset);
+
+  if (n_bytes > 0 && fsync(fh) != 0) {
+    return (-1);
+  }
+
+  return (n_bytes);
+}
+
 /** Do the read/write
 @param[in]	request	The IO context and type
 @return the number of bytes read/written or negative value on error */
@@ -2084,7 +2136,12 @@ ssize_t SyncFileIO::execute(const IORequest &request) {
     n_bytes = pread(m_fh, m_buf, m_n, m_offset);
   } else {
     ut_ad(request.is_write());
-    n_bytes = pwrite(m_fh, m_buf, m_n, m_offset);
+
+    if (request.is_dsync()) {
+      n_bytes = os_file_pwrite_dsync(m_fh, m_buf, m_n, m_offset);
+    } else {
+      n_bytes = pwrite(m_fh, m_buf, m_n, m_offset);
+    }
   }
 
   return (n_bytes);
@@ -2595,6 +2652,95 @@ bool AIO::linux_dispatch(Slot *slot) {
   return (ret == 1);
 }
 
+/** An AIO request queued by AIO::linux_defer() */
+struct Batched_aio {
+  /** io_context of the segment that owns the slot */
+  io_context_t io_ctx;
+
+  /** AIO array that owns the slot */
+  AIO *array;
+
+  /** The reserved slot */
+  Slot *slot;
+};
+
+/** true while the calling thread is between os_aio_batch_start() and
+os_aio_batch_submit() */
+static thread_local bool os_aio_batching = false;
+
+/** AIO requests queued by the calling thread, in the order they were posted */
+static thread_local std::vector<Batched_aio> os_aio_batch;
+
+void AIO::linux_defer(Slot *slot) {
+  ut_a(slot->is_reserved);
+  ut_ad(slot->type.validate());
+  ut_ad(os_aio_batching);
+
+  ulint io_ctx_index = (slot->pos * m_n_segments) / m_slots.size();
+
+  os_aio_batch.push_back({m_aio_ctx[io_ctx_index], this, slot});
+}
+
+void AIO::linux_submit_batch() {
+  /* Requests of one io_context are submitted together; keep them in the
+  order they were posted so that the kernel can still merge them. */
+  std::stable_sort(os_aio_batch.begin(), os_aio_batch.end(),
+                   [](const Batched_aio &lhs, const Batched_aio &rhs) {
+                     return (lhs.io_ctx < rhs.io_ctx);
+                   });
+
+  std::vector<struct iocb *> iocbs;
+
+  iocbs.reserve(os_aio_batch.size());
+
+  auto begin = os_aio_batch.begin();
+
+  while (begin != os_aio_batch.end()) {
+    auto io_ctx = begin->io_ctx;
+    auto end = begin;
+
+    iocbs.clear();
+
+    for (; end != os_aio_batch.end() && end->io_ctx == io_ctx; ++end) {
+      iocbs.push_back(&end->slot->control);
+    }
+
+    size_t n_submitted = 0;
+
+    while (n_submitted < iocbs.size()) {
+      int ret = io_submit(io_ctx, iocbs.size() - n_submitted,
+                          &iocbs[n_submitted]);
+
+      if (ret <= 0) {
+        break;
+      }
+
+      n_submitted += ret;
+    }
+
+    /* Let the single request path report and retry what the kernel
+    did not accept. */
+    for (auto it = begin + n_submitted; it != end; ++it) {
+      Slot *slot = it->slot;
+
+      while (!it->array->linux_dispatch(slot)) {
+        if (!os_file_handle_error(
+                slot->name, slot->type.is_read() ? "aio read" : "aio write")) {
+          ib::fatal(ER_IB_MSG_756) << "Native Linux AIO interface. "
+                                      "io_submit() call failed when "
+                                      "submitting a batch of I/O "
+                                      "requests on the file "
+                                   << slot->name << ".";
+        }
+      }
+    }
+
+    begin = end;
+  }
+
+  os_aio_batch.clear();
+}
+
 /** Creates an io_context for native linux AIO.
 @param[in]	max_events	number of events
 @param[out]	io_ctx		io_ctx to initialize.
@@ -6733,6 +6879,16 @@ Slot *AIO::reserve_slot(IORequest &type, fil_node_t *m1, void *m2,
 
     release();
 
+#if defined(LINUX_NATIVE_AIO)
+    /* Slots of requests that this thread queued since os_aio_batch_start()
+    are only freed after they were submitted: do that before waiting for
+    a free slot, or the thread would wait for itself. */
+    if (!os_aio_batch.empty()) {
+      linux_submit_batch();
+      continue;
+    }
+#endif /* LINUX_NATIVE_AIO */
+
     if (!srv_use_native_aio) {
       /* If the handler threads are suspended,
       wake them so that we get more slots */
@@ -6997,6 +7153,25 @@ void AIO::wake_simulated_handler_thread(ulint global_segment, ulint segment) {
   release();
 }
 
+void os_aio_batch_start() {
+#if defined(LINUX_NATIVE_AIO)
+  ut_ad(!os_aio_batching);
+  ut_ad(os_aio_batch.empty());
+
+  os_aio_batching = srv_use_native_aio;
+#endif /* LINUX_NATIVE_AIO */
+}
+
+void os_aio_batch_submit() {
+#if defined(LINUX_NATIVE_AIO)
+  os_aio_batching = false;
+
+  if (!os_aio_batch.empty()) {
+    AIO::linux_submit_batch();
+  }
+#endif /* LINUX_NATIVE_AIO */
+}
+
 /** Wakes up simulated aio i/o-handler threads if they have something to do. */
 void os_aio_simulated_wake_handler_threads() {
   if (srv_use_native_aio) {
@@ -7295,7 +7470,9 @@ try_again:
       ret = ReadFile(file.m_file, slot->ptr, slot->len, &slot->n_bytes,
                      &slot->control);
 #elif defined(LINUX_NATIVE_AIO)
-      if (!array->linux_dispatch(slot)) {
+      if (os_aio_batching) {
+        array->linux_defer(slot);
+      } else if (!array->linux_dispatch(slot)) {
         goto err_exit;
       }
 #endif /* WIN_ASYNC_IO */
@@ -7312,7 +7489,9 @@ try_again:
       ret = WriteFile(file.m_file, slot->ptr, slot->len, &slot->n_bytes,
                       &slot->control);
 #elif defined(LINUX_NATIVE_AIO)
-      if (!array->linux_dispatch(slot)) {
+      if (os_aio_batching) {
+        array->linux_defer(slot);
+      } else if (!array->linux_dispatch(slot)) {
         goto err_exit;
       }
 #endif /* WIN_ASYNC_IO */
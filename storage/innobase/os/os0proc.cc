@@ -154,6 +154,15 @@ skip:
                              << errno;
     ptr = nullptr;
   } else {
+#if defined(UNIV_LINUX) && defined(MADV_HUGEPAGE)
+    /* Large pages were requested but could not be used (or the
+    platform has no explicit huge page support): ask for transparent
+    huge pages instead so that the area still gets the TLB benefit.
+    This is only a hint; failure is harmless. */
+    if (os_use_large_pages) {
+      (void)madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif /* UNIV_LINUX && MADV_HUGEPAGE */
     os_total_large_mem_allocated.fetch_add(size);
     UNIV_MEM_ALLOC(ptr, size);
   }
@@ -416,8 +416,11 @@ void page_cur_search_with_match(const buf_block_t *block,
   ut_d(page_check_dir(page));
 
 #ifdef PAGE_CUR_ADAPT
-  if (page_is_leaf(page) && (mode == PAGE_CUR_LE) &&
-      !dict_index_is_spatial(index) &&
+  /* The shortcut is also taken on non-leaf pages: PAGE_LAST_INSERT is
+  maintained on every level, and for ascending-key inserts the node
+  pointer pages on the right edge keep growing to the right too, so the
+  descent can skip the binary search on each level. */
+  if ((mode == PAGE_CUR_LE) && !dict_index_is_spatial(index) &&
       (page_header_get_field(page, PAGE_N_DIRECTION) > 3) &&
       (page_header_get_ptr(page, PAGE_LAST_INSERT)) &&
       (page_header_get_field(page, PAGE_DIRECTION) == PAGE_RIGHT)) {
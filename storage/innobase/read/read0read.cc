@@ -315,7 +315,8 @@ ReadView::ReadView()
       m_up_limit_id(),
       m_creator_trx_id(),
       m_ids(),
-      m_low_limit_no() {
+      m_low_limit_no(),
+      m_n_rw_trx_ids_removed() {
   ut_d(::memset(&m_view_list, 0x0, sizeof(m_view_list)));
   ut_d(m_view_low_limit_no = 0);
 }
@@ -436,6 +437,9 @@ void ReadView::prepare(trx_id_t id) {
     m_ids.clear();
   }
 
+  m_n_rw_trx_ids_removed =
+      trx_sys->n_rw_trx_ids_removed.load(std::memory_order_relaxed);
+
   ut_ad(m_up_limit_id <= m_low_limit_id);
 
   /* serialisation_list 是事务的提交顺序列表, 在这里获取所有提交中事务最小的
@@ -517,8 +521,9 @@ freed by calling view_close()
 void MVCC::view_open(ReadView *&view, trx_t *trx) {
   ut_ad(!srv_read_only_mode);
 
-  /** If no new RW transaction has been started since the last view
-  was created then reuse the the existing view. */
+  /** If no new RW transaction has been started, and none of the RW
+  transactions in it has committed, since the last view was created then
+  reuse the the existing view. */
   if (view != nullptr) {
     uintptr_t p = reinterpret_cast<uintptr_t>(view);
 
@@ -526,18 +531,24 @@ void MVCC::view_open(ReadView *&view, trx_t *trx) {
 
     ut_ad(view->m_closed);
 
-    /* NOTE: This can be optimised further, for now we only
-    resuse the view iff there are no active RW transactions.
+    /* Every id added to trx_sys->rw_trx_ids is a new one, which moves
+    trx_sys->max_trx_id, and every removal increments
+    trx_sys->n_rw_trx_ids_removed. If neither has changed, the view is
+    exactly the snapshot we would take now, and we can avoid the trx_sys
+    mutex. An empty view cannot lose ids, so for it the first check is
+    enough.
 
     There is an inherent race here between purge and this
     thread. Purge will skip views that are marked as closed.
     Therefore we must set the low limit id after we reset the
     closed status after the check. */
 
-    if (trx_is_autocommit_non_locking(trx) && view->empty()) {
+    if (trx_is_autocommit_non_locking(trx)) {
       view->m_closed = false;
 
-      if (view->m_low_limit_id == trx_sys_get_max_trx_id()) {
+      if (view->m_low_limit_id == trx_sys_get_max_trx_id() &&
+          (view->empty() || view->m_n_rw_trx_ids_removed ==
+                                trx_sys->n_rw_trx_ids_removed.load())) {
         return;
       } else {
         view->m_closed = true;
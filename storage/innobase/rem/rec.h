@@ -37,6 +37,8 @@ external tools. */
 #ifndef rem_rec_h
 #define rem_rec_h
 
+#include <algorithm>
+
 #include "dict0boot.h"
 #include "dict0dict.h"
 
@@ -755,8 +757,23 @@ void rec_init_offsets_comp_ordinary(
     temp = false;
   }
 
-  /* read the lengths of fields 0..n */
-  do {
+  if (!temp) {
+    /* The leading NOT NULL fixed-length fields have neither a null
+    flag nor a length byte, so their offsets follow from fixed_len. */
+    uint16_t n_fixed = std::min<uint16_t>(
+        std::min<uint16_t>(index->n_fixed_prefix, non_default_fields),
+        static_cast<uint16_t>(rec_offs_n_fields(offsets)));
+
+    for (; i < n_fixed; i++) {
+      ut_ad(index->fields[i].fixed_len > 0);
+      ut_ad(index->fields[i].col->prtype & DATA_NOT_NULL);
+      offs += index->fields[i].fixed_len;
+      rec_offs_base(offsets)[i + 1] = offs;
+    }
+  }
+
+  /* read the lengths of fields i..n */
+  for (; i < rec_offs_n_fields(offsets); i++) {
     const dict_field_t *field = index->get_field(i);
     const dict_col_t *col = field->col;
     uint64_t len;
@@ -826,7 +843,7 @@ void rec_init_offsets_comp_ordinary(
     }
   resolved:
     rec_offs_base(offsets)[i + 1] = len;
-  } while (++i < rec_offs_n_fields(offsets));
+  }
 
   *rec_offs_base(offsets) = (rec - (lens + 1)) | REC_OFFS_COMPACT | any_ext;
 }
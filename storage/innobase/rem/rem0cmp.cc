@@ -35,6 +35,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <spatial.h>
 #include <sys/types.h>
 #include <algorithm>
+#include <atomic>
 
 #include "ha_prototypes.h"
 #include "handler0alter.h"
@@ -63,6 +64,34 @@ At the present, the comparison functions return 0 in the case,
 where two records disagree only in the way that one
 has more fields than the other. */
 
+/** Collations resolved by cmp_get_charset(), indexed by collation number.
+A CHARSET_INFO is never freed once it has been initialized, so the cached
+pointers stay valid for the lifetime of the server. */
+static std::atomic<CHARSET_INFO *> cmp_charset_cache[MY_ALL_CHARSETS_SIZE];
+
+/** Look up a collation for comparing index fields. The result of
+get_charset() is cached so that the charset registry is consulted only on
+the first comparison that uses a given collation.
+@param[in] cs_num collation number
+@return collation, or nullptr if it is not available */
+static inline CHARSET_INFO *cmp_get_charset(uint cs_num) {
+  if (cs_num >= MY_ALL_CHARSETS_SIZE) {
+    return (get_charset(cs_num, MYF(MY_WME)));
+  }
+
+  CHARSET_INFO *cs = cmp_charset_cache[cs_num].load(std::memory_order_acquire);
+
+  if (cs == nullptr) {
+    cs = get_charset(cs_num, MYF(MY_WME));
+
+    if (cs != nullptr) {
+      cmp_charset_cache[cs_num].store(cs, std::memory_order_release);
+    }
+  }
+
+  return (cs);
+}
+
 /** Compare two data fields.
 @param[in] prtype precise type
 @param[in] a data field
@@ -92,7 +121,7 @@ int innobase_mysql_cmp(ulint prtype, const byte *a, size_t a_length,
 
   uint cs_num = (uint)dtype_get_charset_coll(prtype);
 
-  if (CHARSET_INFO *cs = get_charset(cs_num, MYF(MY_WME))) {
+  if (CHARSET_INFO *cs = cmp_get_charset(cs_num)) {
     if ((prtype & DATA_MYSQL_TYPE_MASK) == MYSQL_TYPE_STRING &&
         cs->pad_attribute == NO_PAD) {
       /* MySQL specifies that CHAR fields are stripped of
@@ -204,6 +204,7 @@ use simulated aio we build below with threads. */
 bool srv_use_native_aio = false;
 
 bool srv_numa_interleave = false;
+bool srv_numa_buffer_pool_bind = false;
 
 #ifdef UNIV_DEBUG
 /** Force all user tables to use page compression. */
@@ -249,6 +250,8 @@ ulong srv_log_buffer_size;
 /** Size of block, used for writing ahead to avoid read-on-write. */
 ulong srv_log_write_ahead_size;
 
+bool srv_log_write_dsync = false;
+
 /** Whether to activate/pause the log writer threads. */
 bool srv_log_writer_threads;
 
@@ -429,6 +432,8 @@ instead. */
 ulong srv_n_read_io_threads;
 ulong srv_n_write_io_threads;
 
+ulong srv_n_recv_apply_threads;
+
 /* Switch to enable random read ahead. */
 bool srv_random_read_ahead = FALSE;
 /* User settable value of the number of pages that must be present
@@ -540,6 +545,7 @@ unsigned long long srv_stats_transient_sample_pages = 8;
 bool srv_stats_persistent = TRUE;
 bool srv_stats_include_delete_marked = FALSE;
 unsigned long long srv_stats_persistent_sample_pages = 20;
+ulong srv_stats_persistent_threads = 1;
 bool srv_stats_auto_recalc = TRUE;
 
 ulong srv_replication_delay = 0;
@@ -1595,6 +1601,9 @@ void srv_export_innodb_status(void) {
 
   export_vars.innodb_dblwr_pages_written = srv_stats.dblwr_pages_written;
 
+  export_vars.innodb_dblwr_atomic_bytes_saved =
+      srv_stats.dblwr_atomic_bytes_saved;
+
   export_vars.innodb_dblwr_writes = srv_stats.dblwr_writes;
 
   export_vars.innodb_pages_created = stat.n_pages_created;
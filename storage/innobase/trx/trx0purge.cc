@@ -33,6 +33,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include <sys/types.h>
 #include <new>
 
+#include "buf0rea.h"
 #include "clone0api.h"
 #include "clone0clone.h"
 #include "dict0dd.h"
@@ -1708,6 +1709,26 @@ static void trx_purge_truncate_undo_spaces() {
   }
 }
 
+/** Starts an asynchronous read of an undo log page which purge is going to
+need soon, so that purge does not have to wait for the read when it gets
+there. Does nothing if the page is already in the buffer pool.
+@param[in]	space_id	undo tablespace
+@param[in]	page_no		undo log page, or FIL_NULL
+@param[in]	page_size	page size */
+static void trx_purge_prefetch_undo_page(space_id_t space_id, page_no_t page_no,
+                                         const page_size_t &page_size) {
+  if (page_no == FIL_NULL) {
+    return;
+  }
+
+  if (buf_read_page_background(page_id_t(space_id, page_no), page_size,
+                               false)) {
+    os_aio_simulated_wake_handler_threads();
+
+    MONITOR_INC(MONITOR_PURGE_N_PAGE_PREFETCHED);
+  }
+}
+
 /** Updates the last not yet purged history log info in rseg when we have
  purged a whole undo log. Advances also purge_sys->purge_trx_no past the
  purged log. */
@@ -1807,8 +1828,17 @@ static void trx_purge_rseg_get_next_history_log(
 
   del_marks = mach_read_from_2(log_hdr + TRX_UNDO_DEL_MARKS);
 
+  /* The undo log which follows in the history list of this rseg. */
+  const page_no_t next_log_page_no =
+      trx_purge_get_log_from_hist(
+          flst_get_prev_addr(log_hdr + TRX_UNDO_HISTORY_NODE, &mtr))
+          .page;
+
   mtr_commit(&mtr);
 
+  trx_purge_prefetch_undo_page(rseg->space_id, next_log_page_no,
+                               rseg->page_size);
+
   rseg->latch();
 
   /* 更新回滚段 Purge 相关的信息. */
@@ -2025,6 +2055,14 @@ static trx_undo_rec_t *trx_purge_get_next_rec(
       /* We advance to a new page of the undo log: */
       /* 切到了下一个 Page. */
       (*n_pages_handled)++;
+
+      /* Read ahead the page after it. */
+      trx_purge_prefetch_undo_page(
+          space,
+          flst_get_next_addr(page + TRX_UNDO_PAGE_HDR + TRX_UNDO_PAGE_NODE,
+                             &mtr)
+              .page,
+          page_size);
     }
   }
 
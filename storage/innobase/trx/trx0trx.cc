@@ -1742,6 +1742,8 @@ static void trx_erase_lists(trx_t *trx, bool serialised, Gtid_desc &gtid_desc) {
   ut_ad(*it == trx->id);
   trx_sys->rw_trx_ids.erase(it);
 
+  trx_sys->n_rw_trx_ids_removed.fetch_add(1);
+
   if (trx->read_only || trx->rsegs.m_redo.rseg == nullptr) {
     ut_ad(!trx->in_rw_trx_list);
   } else {
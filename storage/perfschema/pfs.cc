@@ -6007,6 +6007,9 @@ PSI_statement_locker *pfs_get_thread_statement_locker_v2(
     flags |= STATE_FLAG_DIGEST;
   }
 
+  /* The state is a PSI_statement_locker_state_v3, with room for CPU time. */
+  flags |= STATE_FLAG_CPU;
+
   state->m_discarded = false;
   state->m_class = klass;
   state->m_flags = flags;
@@ -6042,6 +6045,25 @@ PSI_statement_locker *pfs_get_thread_statement_locker_v2(
   return reinterpret_cast<PSI_statement_locker *>(state);
 }
 
+/**
+  Implementation of the statement instrumentation interface,
+  for callers built against @c PSI_statement_locker_state_v1.
+  The state has no room for the CPU time, so it is not collected.
+  @sa get_thread_statement_locker_v1_t.
+*/
+static PSI_statement_locker *pfs_get_thread_statement_locker_v1(
+    PSI_statement_locker_state_v1 *state, PSI_statement_key key,
+    const void *charset, PSI_sp_share *sp_share) {
+  PSI_statement_locker_state *state_v3 =
+      reinterpret_cast<PSI_statement_locker_state *>(state);
+  PSI_statement_locker *locker =
+      pfs_get_thread_statement_locker_v2(state_v3, key, charset, sp_share);
+  if (locker != nullptr) {
+    state_v3->m_flags &= ~STATE_FLAG_CPU;
+  }
+  return locker;
+}
+
 PSI_statement_locker *pfs_refine_statement_v2(PSI_statement_locker *locker,
                                               PSI_statement_key key) {
   PSI_statement_locker_state *state =
@@ -6102,6 +6124,9 @@ void pfs_start_statement_v2(PSI_statement_locker *locker, const char *db,
   if (flags & STATE_FLAG_TIMED) {
     timer_start = get_statement_timer();
     state->m_timer_start = timer_start;
+    if (flags & STATE_FLAG_CPU) {
+      state->m_cpu_time_start = get_thread_cpu_time();
+    }
   }
 
   static_assert(PSI_SCHEMA_NAME_LEN == NAME_LEN, "");
@@ -6315,11 +6340,19 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
 
   ulonglong timer_end = 0;
   ulonglong wait_time = 0;
+  ulonglong cpu_time = 0;
   uint flags = state->m_flags;
 
   if (flags & STATE_FLAG_TIMED) {
     timer_end = get_statement_timer();
     wait_time = timer_end - state->m_timer_start;
+
+    if (flags & STATE_FLAG_CPU) {
+      ulonglong cpu_time_end = get_thread_cpu_time();
+      if (cpu_time_end > state->m_cpu_time_start) {
+        cpu_time = cpu_time_end - state->m_cpu_time_start;
+      }
+    }
   }
 
   PFS_statement_stat *event_name_array;
@@ -6451,6 +6484,7 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
   stat->m_sort_scan += state->m_sort_scan;
   stat->m_no_index_used += state->m_no_index_used;
   stat->m_no_good_index_used += state->m_no_good_index_used;
+  stat->m_cpu_time += cpu_time;
 
   if (digest_stat != nullptr) {
     bool new_max_wait = false;
@@ -6531,6 +6565,7 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
     digest_stat->m_stat.m_sort_scan += state->m_sort_scan;
     digest_stat->m_stat.m_no_index_used += state->m_no_index_used;
     digest_stat->m_stat.m_no_good_index_used += state->m_no_good_index_used;
+    digest_stat->m_stat.m_cpu_time += cpu_time;
   } else {
     if (flags & STATE_FLAG_TIMED) {
       time_normalizer *normalizer = time_normalizer::get_statement();
@@ -6569,6 +6604,7 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
       sub_stmt_stat->m_sort_scan += state->m_sort_scan;
       sub_stmt_stat->m_no_index_used += state->m_no_index_used;
       sub_stmt_stat->m_no_good_index_used += state->m_no_good_index_used;
+      sub_stmt_stat->m_cpu_time += cpu_time;
     }
   }
 
@@ -6611,6 +6647,7 @@ void pfs_end_statement_v2(PSI_statement_locker *locker, void *stmt_da) {
         prepared_stmt_stat->m_sort_scan += state->m_sort_scan;
         prepared_stmt_stat->m_no_index_used += state->m_no_index_used;
         prepared_stmt_stat->m_no_good_index_used += state->m_no_good_index_used;
+        prepared_stmt_stat->m_cpu_time += cpu_time;
       }
     }
   }
@@ -7274,6 +7311,7 @@ void pfs_digest_end_v2(PSI_digest_locker *locker,
 
     /* Compute digest hash of the tokens received. */
     compute_digest_hash(digest, update_digest->m_hash);
+    update_digest->m_hash_computed = true;
 
     state->m_digest = digest;
 
@@ -8359,6 +8397,44 @@ SERVICE_IMPLEMENTATION(performance_schema, psi_stage_v1) = {
     pfs_get_current_stage_progress_v1, pfs_end_stage_v1};
 
 PSI_statement_service_v2 pfs_statement_service_v2 = {
+    /* Old interface, for plugins. */
+    pfs_register_statement_v2,
+    pfs_get_thread_statement_locker_v1,
+    pfs_refine_statement_v2,
+    pfs_start_statement_v2,
+    pfs_set_statement_text_v2,
+    pfs_set_statement_query_id_v2,
+    pfs_set_statement_lock_time_v2,
+    pfs_set_statement_rows_sent_v2,
+    pfs_set_statement_rows_examined_v2,
+    pfs_inc_statement_created_tmp_disk_tables_v2,
+    pfs_inc_statement_created_tmp_tables_v2,
+    pfs_inc_statement_select_full_join_v2,
+    pfs_inc_statement_select_full_range_join_v2,
+    pfs_inc_statement_select_range_v2,
+    pfs_inc_statement_select_range_check_v2,
+    pfs_inc_statement_select_scan_v2,
+    pfs_inc_statement_sort_merge_passes_v2,
+    pfs_inc_statement_sort_range_v2,
+    pfs_inc_statement_sort_rows_v2,
+    pfs_inc_statement_sort_scan_v2,
+    pfs_set_statement_no_index_used_v2,
+    pfs_set_statement_no_good_index_used_v2,
+    pfs_end_statement_v2,
+    pfs_create_prepared_stmt_v2,
+    pfs_destroy_prepared_stmt_v2,
+    pfs_reprepare_prepared_stmt_v2,
+    pfs_execute_prepared_stmt_v2,
+    pfs_set_prepared_stmt_text_v2,
+    pfs_digest_start_v2,
+    pfs_digest_end_v2,
+    pfs_get_sp_share_v2,
+    pfs_release_sp_share_v2,
+    pfs_start_sp_v2,
+    pfs_end_sp_v2,
+    pfs_drop_sp_v2};
+
+PSI_statement_service_v3 pfs_statement_service_v3 = {
     /* Old interface, for plugins. */
     pfs_register_statement_v2,
     pfs_get_thread_statement_locker_v2,
@@ -8400,7 +8476,7 @@ SERVICE_TYPE(psi_statement_v1)
 SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v1) = {
     /* New interface, for components. */
     pfs_register_statement_v2,
-    pfs_get_thread_statement_locker_v2,
+    pfs_get_thread_statement_locker_v1,
     pfs_refine_statement_v2,
     pfs_start_statement_v2,
     pfs_set_statement_text_v2,
@@ -8436,6 +8512,45 @@ SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v1) = {
 
 SERVICE_TYPE(psi_statement_v2)
 SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v2) = {
+    /* New interface, for components. */
+    pfs_register_statement_v2,
+    pfs_get_thread_statement_locker_v1,
+    pfs_refine_statement_v2,
+    pfs_start_statement_v2,
+    pfs_set_statement_text_v2,
+    pfs_set_statement_query_id_v2,
+    pfs_set_statement_lock_time_v2,
+    pfs_set_statement_rows_sent_v2,
+    pfs_set_statement_rows_examined_v2,
+    pfs_inc_statement_created_tmp_disk_tables_v2,
+    pfs_inc_statement_created_tmp_tables_v2,
+    pfs_inc_statement_select_full_join_v2,
+    pfs_inc_statement_select_full_range_join_v2,
+    pfs_inc_statement_select_range_v2,
+    pfs_inc_statement_select_range_check_v2,
+    pfs_inc_statement_select_scan_v2,
+    pfs_inc_statement_sort_merge_passes_v2,
+    pfs_inc_statement_sort_range_v2,
+    pfs_inc_statement_sort_rows_v2,
+    pfs_inc_statement_sort_scan_v2,
+    pfs_set_statement_no_index_used_v2,
+    pfs_set_statement_no_good_index_used_v2,
+    pfs_end_statement_v2,
+    pfs_create_prepared_stmt_v2,
+    pfs_destroy_prepared_stmt_v2,
+    pfs_reprepare_prepared_stmt_v2,
+    pfs_execute_prepared_stmt_v2,
+    pfs_set_prepared_stmt_text_v2,
+    pfs_digest_start_v2,
+    pfs_digest_end_v2,
+    pfs_get_sp_share_v2,
+    pfs_release_sp_share_v2,
+    pfs_start_sp_v2,
+    pfs_end_sp_v2,
+    pfs_drop_sp_v2};
+
+SERVICE_TYPE(psi_statement_v3)
+SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v3) = {
     /* New interface, for components. */
     pfs_register_statement_v2,
     pfs_get_thread_statement_locker_v2,
@@ -8682,6 +8797,8 @@ static void *get_statement_interface(int version) {
       return nullptr;
     case PSI_STATEMENT_VERSION_2:
       return &pfs_statement_service_v2;
+    case PSI_STATEMENT_VERSION_3:
+      return &pfs_statement_service_v3;
     default:
       return nullptr;
   }
@@ -8790,9 +8907,11 @@ PROVIDES_SERVICE(performance_schema, psi_cond_v1),
     PROVIDES_SERVICE(performance_schema, psi_rwlock_v2),
     PROVIDES_SERVICE(performance_schema, psi_socket_v1),
     PROVIDES_SERVICE(performance_schema, psi_stage_v1),
-    /* Deprecated, use psi_statement_v2. */
+    /* Deprecated, use psi_statement_v3. */
     PROVIDES_SERVICE(performance_schema, psi_statement_v1),
+    /* Deprecated, use psi_statement_v3. */
     PROVIDES_SERVICE(performance_schema, psi_statement_v2),
+    PROVIDES_SERVICE(performance_schema, psi_statement_v3),
     PROVIDES_SERVICE(performance_schema, psi_system_v1),
     PROVIDES_SERVICE(performance_schema, psi_table_v1),
     /* Obsolete: PROVIDES_SERVICE(performance_schema, psi_thread_v1), */
@@ -68,11 +68,14 @@ extern SERVICE_TYPE(psi_socket_v1)
     SERVICE_IMPLEMENTATION(performance_schema, psi_socket_v1);
 extern SERVICE_TYPE(psi_stage_v1)
     SERVICE_IMPLEMENTATION(performance_schema, psi_stage_v1);
-/* Deprecated, use psi_statement_v2. */
+/* Deprecated, use psi_statement_v3. */
 extern SERVICE_TYPE(psi_statement_v1)
     SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v1);
+/* Deprecated, use psi_statement_v3. */
 extern SERVICE_TYPE(psi_statement_v2)
     SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v2);
+extern SERVICE_TYPE(psi_statement_v3)
+    SERVICE_IMPLEMENTATION(performance_schema, psi_statement_v3);
 extern SERVICE_TYPE(psi_system_v1)
     SERVICE_IMPLEMENTATION(performance_schema, psi_system_v1);
 extern SERVICE_TYPE(psi_table_v1)
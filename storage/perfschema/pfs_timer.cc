@@ -31,6 +31,10 @@
 #include <math.h>
 #include <stddef.h>
 #include <sys/types.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
 
 #include "my_rdtsc.h"
 #include "mysqld_error.h"
@@ -58,6 +62,31 @@ static struct time_normalizer
         {0, 0, {0}}, /* millisec */
 };
 
+ulonglong get_thread_cpu_time() {
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec tp;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &tp) != 0) {
+    return 0;
+  }
+  return static_cast<ulonglong>(tp.tv_sec) * 1000000000ULL + tp.tv_nsec;
+#elif defined(_WIN32)
+  FILETIME create_time, exit_time, kernel_time, user_time;
+  if (!GetThreadTimes(GetCurrentThread(), &create_time, &exit_time,
+                      &kernel_time, &user_time)) {
+    return 0;
+  }
+  ULARGE_INTEGER kernel, user;
+  kernel.LowPart = kernel_time.dwLowDateTime;
+  kernel.HighPart = kernel_time.dwHighDateTime;
+  user.LowPart = user_time.dwLowDateTime;
+  user.HighPart = user_time.dwHighDateTime;
+  /* FILETIME is expressed in 100 nano seconds units. */
+  return (kernel.QuadPart + user.QuadPart) * 100;
+#else
+  return 0;
+#endif
+}
+
 void init_timers(void) {
   double pico_frequency = 1.0e12;
 
@@ -36,6 +36,8 @@
 
 /** Conversion factor, from micro seconds to pico seconds. */
 #define MICROSEC_TO_PICOSEC 1000000
+/** Conversion factor, from nano seconds to pico seconds. */
+#define NANOSEC_TO_PICOSEC 1000
 
 #ifndef MY_CONFIG_H
 /* my_config.h MUST be included before testing HAVE_XXX flags. */
@@ -103,6 +105,12 @@ ulonglong inline get_statement_timer() { return USED_TIMER(); }
 
 ulonglong inline get_transaction_timer() { return USED_TIMER(); }
 
+/**
+  CPU time consumed so far by the calling thread.
+  @return the thread CPU time in nanoseconds, or 0 if not supported
+*/
+ulonglong get_thread_cpu_time();
+
 /**
   A time normalizer.
   A time normalizer consist of a transformation that
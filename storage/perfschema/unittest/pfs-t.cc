@@ -255,6 +255,8 @@ static void test_bootstrap() {
   ok(psi == nullptr, "no statement version 1");
   psi = statement_boot->get_interface(PSI_STATEMENT_VERSION_2);
   ok(psi != nullptr, "statement version 2");
+  psi = statement_boot->get_interface(PSI_STATEMENT_VERSION_3);
+  ok(psi != nullptr, "statement version 3");
 
   psi = transaction_boot->get_interface(0);
   ok(psi == nullptr, "no transaction version 0");
@@ -398,7 +400,7 @@ static void load_perfschema(
   *stage_service =
       (PSI_stage_service_t *)stage_boot->get_interface(PSI_SOCKET_VERSION_1);
   *statement_service = (PSI_statement_service_t *)statement_boot->get_interface(
-      PSI_STATEMENT_VERSION_2);
+      PSI_STATEMENT_VERSION_3);
   *system_service =
       (PSI_system_service_t *)system_boot->get_interface(PSI_SYSTEM_VERSION_1);
   *transaction_service =
@@ -1928,7 +1930,7 @@ static void test_event_name_index() {
       (PSI_stage_service_t *)stage_boot->get_interface(PSI_STAGE_VERSION_1);
   ok(stage_service != nullptr, "stage_service");
   statement_service = (PSI_statement_service_t *)statement_boot->get_interface(
-      PSI_STATEMENT_VERSION_2);
+      PSI_STATEMENT_VERSION_3);
   ok(statement_service != nullptr, "statement_service");
   transaction_service =
       (PSI_transaction_service_t *)transaction_boot->get_interface(
@@ -2541,7 +2543,7 @@ static void do_all_tests() {
 }
 
 int main(int, char **) {
-  plan(360);
+  plan(361);
 
   MY_INIT("pfs-t");
   do_all_tests();
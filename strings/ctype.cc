@@ -854,6 +854,53 @@ bool my_charset_is_ascii_compatible(const CHARSET_INFO *cs) {
   return true;
 }
 
+/**
+  Convert one character from from_cs to to_cs, advancing *from and *to.
+  Characters that cannot be read or converted are replaced by '?' and
+  counted in *error_count.
+
+  @return false if the input ends with an incomplete character or there is
+    no room for the converted character, true otherwise.
+*/
+static inline bool my_convert_char(char **to, uchar *to_end,
+                                   const CHARSET_INFO *to_cs,
+                                   const char **from, const uchar *from_end,
+                                   const CHARSET_INFO *from_cs,
+                                   uint *error_count) {
+  int cnvres;
+  my_wc_t wc;
+
+  if ((cnvres = (*from_cs->cset->mb_wc)(
+           from_cs, &wc, pointer_cast<const uchar *>(*from), from_end)) > 0)
+    *from += cnvres;
+  else if (cnvres == MY_CS_ILSEQ) {
+    (*error_count)++;
+    (*from)++;
+    wc = '?';
+  } else if (cnvres > MY_CS_TOOSMALL) {
+    /*
+      A correct multibyte sequence detected
+      But it doesn't have Unicode mapping.
+    */
+    (*error_count)++;
+    *from += (-cnvres);
+    wc = '?';
+  } else
+    return false;  // Not enough characters
+
+outp:
+  if ((cnvres = (*to_cs->cset->wc_mb)(to_cs, wc, pointer_cast<uchar *>(*to),
+                                       to_end)) > 0)
+    *to += cnvres;
+  else if (cnvres == MY_CS_ILUNI && wc != '?') {
+    (*error_count)++;
+    wc = '?';
+    goto outp;
+  } else
+    return false;
+  return true;
+}
+
 /**
   Convert a string between two character sets.
   'to' must be large enough to store (form_length * to_cs->mbmaxlen) bytes.
@@ -873,43 +920,13 @@ static size_t my_convert_internal(char *to, size_t to_length,
                                   const CHARSET_INFO *to_cs, const char *from,
                                   size_t from_length,
                                   const CHARSET_INFO *from_cs, uint *errors) {
-  int cnvres;
-  my_wc_t wc;
   const uchar *from_end = (const uchar *)from + from_length;
   char *to_start = to;
   uchar *to_end = (uchar *)to + to_length;
-  my_charset_conv_mb_wc mb_wc = from_cs->cset->mb_wc;
-  my_charset_conv_wc_mb wc_mb = to_cs->cset->wc_mb;
   uint error_count = 0;
 
-  while (true) {
-    if ((cnvres = (*mb_wc)(from_cs, &wc, pointer_cast<const uchar *>(from),
-                           from_end)) > 0)
-      from += cnvres;
-    else if (cnvres == MY_CS_ILSEQ) {
-      error_count++;
-      from++;
-      wc = '?';
-    } else if (cnvres > MY_CS_TOOSMALL) {
-      /*
-        A correct multibyte sequence detected
-        But it doesn't have Unicode mapping.
-      */
-      error_count++;
-      from += (-cnvres);
-      wc = '?';
-    } else
-      break;  // Not enough characters
-
-  outp:
-    if ((cnvres = (*wc_mb)(to_cs, wc, (uchar *)to, to_end)) > 0)
-      to += cnvres;
-    else if (cnvres == MY_CS_ILUNI && wc != '?') {
-      error_count++;
-      wc = '?';
-      goto outp;
-    } else
-      break;
+  while (my_convert_char(&to, to_end, to_cs, &from, from_end, from_cs,
+                         &error_count)) {
   }
   *errors = error_count;
   return (uint32)(to - to_start);
@@ -918,6 +935,8 @@ static size_t my_convert_internal(char *to, size_t to_length,
 /**
   Convert a string between two character sets.
    Optimized for quick copying of ASCII characters in the range 0x00..0x7F.
+   Runs of ASCII characters are copied eight bytes at a time, also between
+   non-ASCII characters, which are converted one by one.
   'to' must be large enough to store (form_length * to_cs->mbmaxlen) bytes.
 
   @param [out] to       Store result here
@@ -934,7 +953,6 @@ static size_t my_convert_internal(char *to, size_t to_length,
 size_t my_convert(char *to, size_t to_length, const CHARSET_INFO *to_cs,
                   const char *from, size_t from_length,
                   const CHARSET_INFO *from_cs, uint *errors) {
-  size_t length, length2;
   /*
     If any of the character sets is not ASCII compatible,
     immediately switch to slow mb_wc->wc_mb method.
@@ -943,39 +961,42 @@ size_t my_convert(char *to, size_t to_length, const CHARSET_INFO *to_cs,
     return my_convert_internal(to, to_length, to_cs, from, from_length, from_cs,
                                errors);
 
-  length = length2 = std::min(to_length, from_length);
-
-#if defined(__i386__) || defined(_WIN32) || defined(__x86_64__)
-  /*
-    Special loop for i386, it allows to refer to a
-    non-aligned memory block as UINT32, which makes
-    it possible to copy four bytes at once. This
-    gives about 10% performance improvement comparing
-    to byte-by-byte loop.
-  */
-  for (; length >= 4; length -= 4, from += 4, to += 4) {
-    if (uint4korr(from) & 0x80808080) break;
-    int4store(to, uint4korr(from));
-  }
-#endif /* __i386__ */
+  const uchar *from_end = pointer_cast<const uchar *>(from) + from_length;
+  uchar *to_end = pointer_cast<uchar *>(to) + to_length;
+  char *to_start = to;
+  uint error_count = 0;
 
-  for (;; *to++ = *from++, length--) {
-    if (!length) {
-      *errors = 0;
-      return length2;
+  for (;;) {
+    const size_t length =
+        std::min<size_t>(to_end - pointer_cast<uchar *>(to),
+                         from_end - pointer_cast<const uchar *>(from));
+    size_t copied = 0;
+
+    /*
+      Test and copy eight bytes at once; memcpy() of a fixed size compiles
+      to plain unaligned loads and stores.
+    */
+    for (; copied + 8 <= length; copied += 8) {
+      uint64 eight_bytes;
+      memcpy(&eight_bytes, from + copied, sizeof(eight_bytes));
+      if (eight_bytes & 0x8080808080808080ULL) break;
+      memcpy(to + copied, &eight_bytes, sizeof(eight_bytes));
     }
-    if ((static_cast<uchar>(*from)) > 0x7F) /* A non-ASCII character */
-    {
-      size_t copied_length = length2 - length;
-      to_length -= copied_length;
-      from_length -= copied_length;
-      return copied_length + my_convert_internal(to, to_length, to_cs, from,
-                                                 from_length, from_cs, errors);
-    }
-  }
+    for (; copied < length && static_cast<uchar>(from[copied]) <= 0x7F;
+         ++copied)
+      to[copied] = from[copied];
+    from += copied;
+    to += copied;
+
+    if (copied == length) break;  // Input consumed, or output full
 
-  assert(false);  // Should never get to here
-  return 0;       // Make compiler happy
+    // A non-ASCII character.
+    if (!my_convert_char(&to, to_end, to_cs, &from, from_end, from_cs,
+                         &error_count))
+      break;
+  }
+  *errors = error_count;
+  return to - to_start;
 }
 
 /**
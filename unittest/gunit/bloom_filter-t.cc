@@ -0,0 +1,67 @@
+/* Copyright (c) 2021, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+#include <gtest/gtest.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sql/bloom_filter.h"
+
+namespace bloom_filter_unittest {
+
+TEST(BloomFilterTest, NoFalseNegatives) {
+  BloomFilter filter;
+  filter.Init(10000);
+  for (uint64_t i = 0; i < 10000; ++i) filter.Insert(i * 7919);
+  for (uint64_t i = 0; i < 10000; ++i) {
+    EXPECT_TRUE(filter.MayContain(i * 7919));
+  }
+}
+
+TEST(BloomFilterTest, FalsePositiveRate) {
+  BloomFilter filter;
+  filter.Init(10000);
+  for (uint64_t i = 0; i < 10000; ++i) filter.Insert(i);
+
+  size_t false_positives = 0;
+  for (uint64_t i = 10000; i < 110000; ++i) {
+    if (filter.MayContain(i)) ++false_positives;
+  }
+  // With eight bits per key, expect well below 10% false positives.
+  EXPECT_LT(false_positives, 10000U);
+}
+
+TEST(BloomFilterTest, Reinit) {
+  BloomFilter filter;
+  EXPECT_FALSE(filter.Initialized());
+  filter.Init(1);
+  filter.Insert(42);
+  EXPECT_TRUE(filter.MayContain(42));
+
+  filter.Init(100);
+  EXPECT_FALSE(filter.MayContain(42));
+
+  filter.Reset();
+  EXPECT_FALSE(filter.Initialized());
+}
+
+}  // namespace bloom_filter_unittest
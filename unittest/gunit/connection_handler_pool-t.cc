@@ -0,0 +1,195 @@
+/* Copyright (c) 2021, Oracle and/or its affiliates.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License, version 2.0,
+   as published by the Free Software Foundation.
+
+   This program is also distributed with certain software (including
+   but not limited to OpenSSL) that is licensed under separate terms,
+   as designated in a particular file or component or in included license
+   documentation.  The authors of MySQL hereby grant you an additional
+   permission to link the program and your derivative works with the
+   separately licensed software that they have included with MySQL.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License, version 2.0, for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301  USA */
+
+/**
+  This is unit test for the Thread_pool_connection_handler class.
+*/
+
+#include "my_config.h"
+
+#include <gtest/gtest.h>
+
+#ifdef HAVE_EPOLL
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "mysql/psi/mysql_socket.h"
+#include "sql/conn_handler/connection_handler_impl.h"
+#include "sql/conn_handler/thread_pool_queue.h"
+#include "violite.h"
+
+namespace connection_handler_pool_unittest {
+
+using Wakeup = Thread_pool_connection_handler::Wakeup;
+
+TEST(ThreadPoolQueueTest, HighPriorityFirstThenFifo) {
+  int a = 1, b = 2, c = 3, d = 4;
+  Thread_pool_queue<int> queue;
+  EXPECT_EQ(nullptr, queue.pop());
+
+  queue.push(&a, false);
+  queue.push(&b, true);
+  queue.push(&c, false);
+  queue.push(&d, true);
+  EXPECT_EQ(4U, queue.size());
+
+  EXPECT_EQ(&b, queue.pop());
+  EXPECT_EQ(&d, queue.pop());
+  EXPECT_EQ(&a, queue.pop());
+  EXPECT_EQ(&c, queue.pop());
+  EXPECT_EQ(nullptr, queue.pop());
+  EXPECT_EQ(0U, queue.size());
+}
+
+TEST(ThreadPoolQueueTest, StealTakesNewestLowPriority) {
+  int a = 1, b = 2, c = 3;
+  Thread_pool_queue<int> queue;
+  queue.push(&a, false);
+  queue.push(&b, false);
+  queue.push(&c, true);
+
+  EXPECT_EQ(&b, queue.steal());
+  EXPECT_EQ(&a, queue.steal());
+  // High priority sessions stay with their group.
+  EXPECT_EQ(nullptr, queue.steal());
+  EXPECT_EQ(1U, queue.size());
+  EXPECT_EQ(&c, queue.pop());
+}
+
+class ThreadPoolWakeupTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_old_max_threads = Thread_pool_connection_handler::max_threads;
+    m_old_oversubscribe = Thread_pool_connection_handler::oversubscribe;
+    Thread_pool_connection_handler::max_threads = 10;
+    Thread_pool_connection_handler::oversubscribe = 3;
+  }
+  void TearDown() override {
+    Thread_pool_connection_handler::max_threads = m_old_max_threads;
+    Thread_pool_connection_handler::oversubscribe = m_old_oversubscribe;
+  }
+
+ private:
+  uint m_old_max_threads;
+  uint m_old_oversubscribe;
+};
+
+TEST_F(ThreadPoolWakeupTest, IdleWorkerIsPreferred) {
+  EXPECT_EQ(Wakeup::SIGNAL_WORKER,
+            Thread_pool_connection_handler::wakeup_action(1, 0, false, 10));
+}
+
+TEST_F(ThreadPoolWakeupTest, Oversubscribe) {
+  EXPECT_EQ(Wakeup::CREATE_WORKER,
+            Thread_pool_connection_handler::wakeup_action(0, 2, false, 2));
+  EXPECT_EQ(Wakeup::NONE,
+            Thread_pool_connection_handler::wakeup_action(0, 3, false, 3));
+  // A stalled group may go beyond oversubscribe.
+  EXPECT_EQ(Wakeup::CREATE_WORKER,
+            Thread_pool_connection_handler::wakeup_action(0, 3, true, 3));
+}
+
+TEST_F(ThreadPoolWakeupTest, ThreadCap) {
+  EXPECT_EQ(Wakeup::CREATE_WORKER,
+            Thread_pool_connection_handler::wakeup_action(0, 0, true, 9));
+  EXPECT_EQ(Wakeup::NONE,
+            Thread_pool_connection_handler::wakeup_action(0, 0, true, 10));
+  EXPECT_EQ(Wakeup::NONE,
+            Thread_pool_connection_handler::wakeup_action(0, 0, false, 11));
+}
+
+/// Register the session socket with epoll the way arm_connection() does.
+static int register_session(int pollfd, MYSQL_SOCKET socket) {
+  const int poll_fd = Thread_pool_connection_handler::poll_descriptor(socket);
+  if (poll_fd < 0) return -1;
+  epoll_event ev;
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  ev.data.fd = poll_fd;
+  if (epoll_ctl(pollfd, EPOLL_CTL_ADD, poll_fd, &ev) != 0) {
+    close(poll_fd);
+    return -1;
+  }
+  return poll_fd;
+}
+
+TEST(ThreadPoolKillTest, WakeSessionWakesEpoll) {
+  int fds[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+  int pollfd = epoll_create1(EPOLL_CLOEXEC);
+  ASSERT_LE(0, pollfd);
+
+  MYSQL_SOCKET socket = MYSQL_INVALID_SOCKET;
+  mysql_socket_setfd(&socket, fds[0]);
+  const int poll_fd = register_session(pollfd, socket);
+  ASSERT_LE(0, poll_fd);
+
+  epoll_event events[1];
+  EXPECT_EQ(0, epoll_wait(pollfd, events, 1, 0));
+
+  Thread_pool_connection_handler::wake_session(poll_fd);
+
+  ASSERT_EQ(1, epoll_wait(pollfd, events, 1, 1000));
+  EXPECT_EQ(poll_fd, events[0].data.fd);
+
+  close(poll_fd);
+  close(pollfd);
+  close(fds[0]);
+  close(fds[1]);
+}
+
+TEST(ThreadPoolKillTest, KilledIdleSessionWakesEpoll) {
+  int fds[2];
+  ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+  int pollfd = epoll_create1(EPOLL_CLOEXEC);
+  ASSERT_LE(0, pollfd);
+
+  Vio *vio = vio_new(fds[0], VIO_TYPE_SOCKET, 0);
+  ASSERT_NE(nullptr, vio);
+  const int poll_fd = register_session(pollfd, vio->mysql_socket);
+  ASSERT_LE(0, poll_fd);
+
+  epoll_event events[1];
+  EXPECT_EQ(0, epoll_wait(pollfd, events, 1, 0));
+
+  // KILL runs THD::shutdown_active_vio() before post_kill_notification,
+  // which shuts down and closes the descriptor of the Vio.
+  vio_shutdown(vio);
+  EXPECT_GT(0, mysql_socket_getfd(vio->mysql_socket));
+
+  ASSERT_EQ(1, epoll_wait(pollfd, events, 1, 1000));
+  EXPECT_EQ(poll_fd, events[0].data.fd);
+  EXPECT_NE(0U, events[0].events & (EPOLLHUP | EPOLLRDHUP));
+
+  // What pool_post_kill_notification() does afterwards must be harmless.
+  Thread_pool_connection_handler::wake_session(poll_fd);
+
+  vio_delete(vio);
+  close(poll_fd);
+  close(pollfd);
+  close(fds[1]);
+}
+
+}  // namespace connection_handler_pool_unittest
+
+#endif  // HAVE_EPOLL
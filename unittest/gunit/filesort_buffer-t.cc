@@ -25,9 +25,11 @@
 #include <sys/types.h>
 #include <utility>
 
+#include "my_byteorder.h"
 #include "my_inttypes.h"
 #include "my_pointer_arithmetic.h"
 #include "sql/filesort_utils.h"
+#include "sql/sort_param.h"
 #include "sql/table.h"
 
 namespace filesort_buffer_unittest {
@@ -162,4 +164,61 @@ TEST_F(FileSortBufferTest, PreallocateRecords) {
   }
 }
 
+TEST_F(FileSortBufferTest, ParallelStableSort) {
+  // Each record is a two-byte key followed by its four-byte insert order,
+  // which is not part of the compared key but lets us check stability.
+  const uint num_records = 200000;
+  fs_info.set_max_size(10485760, 6);
+  for (uint ix = 0; ix < num_records; ++ix) {
+    Bounds_checked_array<uchar> buf = fs_info.get_next_record_pointer(6);
+    ASSERT_GE(buf.size(), 6);
+    int2store(buf.array(), (ix * 7919) % 1000);
+    int4store(buf.array() + 2, ix);
+    fs_info.commit_used_memory(6);
+  }
+
+  Sort_param param;
+  param.set_max_compare_length(2);
+  param.m_force_stable_sort = true;
+  param.m_sort_threads = 4;
+  EXPECT_EQ(num_records,
+            fs_info.sort_buffer(&param, num_records, num_records));
+
+  uchar **data = fs_info.get_sort_keys();
+  for (uint ix = 1; ix < num_records; ++ix) {
+    const int cmp = memcmp(data[ix - 1], data[ix], 2);
+    ASSERT_LE(cmp, 0) << "index:" << ix;
+    if (cmp == 0)
+      ASSERT_LT(uint4korr(data[ix - 1] + 2), uint4korr(data[ix] + 2));
+  }
+}
+
+TEST_F(FileSortBufferTest, ParallelSortBoundedByMaxSortThreads) {
+  const uint num_records = 200000;
+  const ulong old_max_sort_threads = max_sort_threads;
+  fs_info.set_max_size(10485760, 4);
+  for (uint ix = 0; ix < num_records; ++ix) {
+    Bounds_checked_array<uchar> buf = fs_info.get_next_record_pointer(4);
+    ASSERT_GE(buf.size(), 4);
+    int4store(buf.array(), (ix * 7919) % num_records);
+    fs_info.commit_used_memory(4);
+  }
+
+  // No free helper threads at all, then fewer than the session asks for.
+  for (ulong limit : {0UL, 1UL}) {
+    max_sort_threads = limit;
+    Sort_param param;
+    param.set_max_compare_length(4);
+    param.m_sort_threads = 4;
+    EXPECT_EQ(num_records,
+              fs_info.sort_buffer(&param, num_records, num_records));
+
+    uchar **data = fs_info.get_sort_keys();
+    for (uint ix = 1; ix < num_records; ++ix) {
+      ASSERT_LE(memcmp(data[ix - 1], data[ix], 4), 0) << "index:" << ix;
+    }
+  }
+  max_sort_threads = old_max_sort_threads;
+}
+
 }  // namespace filesort_buffer_unittest
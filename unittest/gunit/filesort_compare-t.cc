@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "my_byteorder.h"
@@ -86,7 +87,7 @@ class FileSortBMHelper {
   // (actually: we only sort the sort_keys below, data is stable).
   std::vector<int> test_data;
 
-  FileSortBMHelper() {
+  explicit FileSortBMHelper(bool shuffle_keys = false) {
     test_data.reserve(num_records * keys_per_record);
     union {
       int val;
@@ -106,6 +107,10 @@ class FileSortBMHelper {
     for (int ix = 0; ix < num_records; ++ix)
       sort_keys[ix] = static_cast<uchar *>(
           static_cast<void *>(&test_data[keys_per_record * ix]));
+    if (shuffle_keys) {
+      std::mt19937 rng(42);
+      std::shuffle(sort_keys.get(), sort_keys.get() + num_records, rng);
+    }
   }
 
   std::vector<uchar *> GetKeys() const {
@@ -393,6 +398,58 @@ static void BM_StdStableSortCompare5(size_t num_iterations) {
 }
 BENCHMARK(BM_StdStableSortCompare5)
 
+TEST(FileSortCompareTest, RadixSortMatchesStableSort) {
+  for (bool shuffle_keys : {false, true}) {
+    FileSortBMHelper helper(shuffle_keys);
+    std::vector<uchar *> expected = helper.GetKeys();
+    std::stable_sort(expected.begin(), expected.end(),
+                     Mem_compare_memcmp(helper.record_size));
+    std::vector<uchar *> keys = helper.GetKeys();
+    radix_sort_keys(keys.data(), keys.data() + keys.size(),
+                    helper.record_size);
+    EXPECT_EQ(expected, keys);
+  }
+}
+
+/*
+  radix_sort_keys() against std::stable_sort, on the (mostly pre-sorted)
+  keys used above and on the same keys in random order.
+ */
+static void RunRadixSortBenchmark(size_t num_iterations, bool shuffle_keys) {
+  StopBenchmarkTiming();
+  FileSortBMHelper helper(shuffle_keys);
+  for (size_t ix = 0; ix < num_iterations; ++ix) {
+    std::vector<uchar *> keys = helper.GetKeys();
+    StartBenchmarkTiming();
+    radix_sort_keys(keys.data(), keys.data() + keys.size(),
+                    helper.record_size);
+    StopBenchmarkTiming();
+  }
+}
+
+static void BM_RadixSort(size_t num_iterations) {
+  RunRadixSortBenchmark(num_iterations, /*shuffle_keys=*/false);
+}
+BENCHMARK(BM_RadixSort)
+
+static void BM_RadixSortShuffled(size_t num_iterations) {
+  RunRadixSortBenchmark(num_iterations, /*shuffle_keys=*/true);
+}
+BENCHMARK(BM_RadixSortShuffled)
+
+static void BM_StdStableSortmemcmpShuffled(size_t num_iterations) {
+  StopBenchmarkTiming();
+  FileSortBMHelper helper(/*shuffle_keys=*/true);
+  for (size_t ix = 0; ix < num_iterations; ++ix) {
+    std::vector<uchar *> keys = helper.GetKeys();
+    StartBenchmarkTiming();
+    std::stable_sort(keys.begin(), keys.end(),
+                     Mem_compare_memcmp(helper.record_size));
+    StopBenchmarkTiming();
+  }
+}
+BENCHMARK(BM_StdStableSortmemcmpShuffled)
+
 // Disabled: experimental.
 static void MY_ATTRIBUTE((unused)) BM_StdSortIntCompare(size_t num_iterations) {
   RunSortBenchmark<Mem_compare_int>(num_iterations, /*stable_sort=*/false);
@@ -25,7 +25,10 @@
 #include <stddef.h>
 #include <sys/types.h>
 
+#include "sql/basic_row_iterators.h"
+#include "sql/sql_class.h"
 #include "sql/sql_executor.h"
+#include "sql/sql_lex.h"
 #include "unittest/gunit/fake_table.h"
 #include "unittest/gunit/mock_field_datetime.h"
 #include "unittest/gunit/test_utils.h"
@@ -35,6 +38,8 @@ namespace {
 using my_testing::Mock_error_handler;
 using my_testing::Server_initializer;
 
+using ::testing::_;
+using ::testing::Return;
 using ::testing::StrictMock;
 
 class HandlerTest : public ::testing::Test {
@@ -289,4 +294,66 @@ TEST_F(HandlerTest, SamplingInterfaceNoRows) {
   EXPECT_EQ(mock_handler.inited, handler::NONE);
 }
 
+/**
+  Set up a table which TableScanIterator may read in batches of
+  table_scan_batch_rows rows, i.e. one read by a non-locking SELECT through a
+  handler whose position() works from the row contents.
+*/
+static void setup_batched_scan(THD *thd, Fake_TABLE *table) {
+  thd->lex->sql_command = SQLCOM_SELECT;
+  thd->variables.table_scan_batch_rows = 16;
+  table->reginfo.lock_type = TL_READ;
+  table->s->tmp_table = INTERNAL_TMP_TABLE;
+  table->s->reclength = 8;
+  ON_CALL(table->mock_handler, table_flags())
+      .WillByDefault(
+          Return(HA_PRIMARY_KEY_REQUIRED_FOR_POSITION | HA_RND_NEXT_BATCH));
+  table->file->init();
+}
+
+TEST_F(HandlerTest, TableScanNeedsNativeBatches) {
+  Fake_TABLE table(1, false);
+  setup_batched_scan(thd(), &table);
+
+  // Without its own rnd_next_batch() the handler is read one row at a time.
+  ON_CALL(table.mock_handler, table_flags())
+      .WillByDefault(Return(HA_PRIMARY_KEY_REQUIRED_FOR_POSITION));
+  table.file->init();
+
+  TableScanIterator iterator(thd(), &table, 100.0, nullptr);
+  ASSERT_FALSE(iterator.Init());
+
+  EXPECT_CALL(table.mock_handler, rnd_next(_)).Times(1);
+  EXPECT_EQ(0, iterator.Read());
+}
+
+TEST_F(HandlerTest, TableScanReadsBatches) {
+  Fake_TABLE table(1, false);
+  setup_batched_scan(thd(), &table);
+
+  TableScanIterator iterator(thd(), &table, 100.0, nullptr);
+  ASSERT_FALSE(iterator.Init());
+
+  // The first row fetches a whole batch from the handler.
+  EXPECT_CALL(table.mock_handler, rnd_next(_)).Times(16);
+  EXPECT_EQ(0, iterator.Read());
+}
+
+TEST_F(HandlerTest, TableScanDoesNotBatchBlobs) {
+  Fake_TABLE table(1, false);
+  setup_batched_scan(thd(), &table);
+
+  /*
+    Rows with BLOB columns point into engine memory that is reused for the
+    next row, so they must be fetched one at a time.
+  */
+  table.s->blob_fields = 1;
+
+  TableScanIterator iterator(thd(), &table, 100.0, nullptr);
+  ASSERT_FALSE(iterator.Init());
+
+  EXPECT_CALL(table.mock_handler, rnd_next(_)).Times(1);
+  EXPECT_EQ(0, iterator.Read());
+}
+
 }  // namespace
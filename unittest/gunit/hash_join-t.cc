@@ -732,6 +732,38 @@ TEST(HashJoinTest, LeftHashJoinInt) {
   initializer.TearDown();
 }
 
+TEST(HashJoinTest, ReservedTableLeavesRoomForRows) {
+  my_testing::Server_initializer initializer;
+  initializer.SetUp();
+
+  HashJoinTestHelper test_helper(&initializer, vector<int>{}, vector<int>{});
+  TABLE *table = test_helper.right_qep_tab->table();
+
+  // A default-sized join buffer, and an estimate far larger than what fits.
+  // Reserving the hash table for the estimate must not fill the buffer
+  // before any rows are stored.
+  constexpr size_t kJoinBufferSize = 256 * 1024;
+  constexpr size_t kNumRows = 2000;
+  hash_join_buffer::HashJoinRowBuffer buffer(
+      TableCollection(test_helper.right_qep_tab->join(),
+                      test_helper.right_map(), /*store_rowids=*/false,
+                      /*tables_to_get_rowid_for=*/0),
+      {*test_helper.join_condition}, kJoinBufferSize);
+  ASSERT_FALSE(buffer.Init(/*expected_rows=*/1000000.0));
+
+  for (size_t i = 0; i < kNumRows; ++i) {
+    table->field[0]->store(static_cast<longlong>(i), /*unsigned_val=*/false);
+    ASSERT_EQ(hash_join_buffer::StoreRowResult::ROW_STORED,
+              buffer.StoreRow(initializer.thd(),
+                              /*reject_duplicate_keys=*/false,
+                              /*store_rows_with_null_in_condition=*/false))
+        << "row:" << i;
+  }
+  EXPECT_EQ(kNumRows, buffer.size());
+
+  initializer.TearDown();
+}
+
 TEST(HashJoinTest, HashJoinResetNullFlagBeforeBuild) {
   my_testing::Server_initializer initializer;
   initializer.SetUp();
@@ -1472,6 +1472,18 @@ TEST(ut0crc32, basic) {
   delete[] buf;
 }
 
+/* test ut_crc32() on lengths around the parallel block boundaries */
+TEST(ut0crc32, lengths) {
+  init();
+
+  for (size_t offset = 0; offset < 8; offset++) {
+    for (size_t len = 0; len + offset <= sizeof(page); len += 61) {
+      EXPECT_EQ(ut_crc32_byte_by_byte(page + offset, len),
+                ut_crc32(page + offset, len));
+    }
+  }
+}
+
 static void BM_CRC32(size_t num_iterations) {
   StopBenchmarkTiming();
   init();
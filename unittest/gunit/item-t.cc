@@ -27,6 +27,7 @@
 #include <sys/types.h>
 #include <memory>
 #include <new>
+#include <vector>
 
 #include "decimal.h"
 #include "field_types.h"
@@ -908,4 +909,34 @@ TEST_F(ItemTest, ItemJson) {
   EXPECT_EQ(time.neg, time_result.neg);
 }
 
+TEST_F(ItemTest, InLongLongHashLookup) {
+  // Long enough for in_longlong to look values up through its hash set.
+  const longlong n = 1000;
+  std::vector<Item *> items;
+  for (longlong i = 0; i < n; ++i) items.push_back(new Item_int(i * 3));
+  items.push_back(new Item_int(-2LL));
+  items.push_back(new Item_int(ULLONG_MAX));
+
+  in_longlong list(thd()->mem_root, items.size());
+  EXPECT_FALSE(list.fill(items.data(), items.size()));
+
+  for (longlong i = -1; i < 3 * n + 1; ++i) {
+    Item_int probe(i);
+    EXPECT_EQ(i >= 0 && i % 3 == 0, list.find_item(&probe)) << i;
+  }
+
+  // Signedness follows cmp_longlong(): equal bits only match across
+  // signedness if the value fits in the positive signed range.
+  Item_int unsigned_hit(ulonglong{30});
+  EXPECT_TRUE(list.find_item(&unsigned_hit));
+  Item_int signed_minus_two(-2LL);
+  EXPECT_TRUE(list.find_item(&signed_minus_two));
+  Item_int unsigned_minus_two(static_cast<ulonglong>(-2LL));
+  EXPECT_FALSE(list.find_item(&unsigned_minus_two));
+  Item_int unsigned_max(ULLONG_MAX);
+  EXPECT_TRUE(list.find_item(&unsigned_max));
+  Item_int signed_minus_one(-1LL);
+  EXPECT_FALSE(list.find_item(&signed_minus_one));
+}
+
 }  // namespace item_unittest
@@ -198,4 +198,104 @@ TEST_F(MyAllocTest, RawInterface) {
   EXPECT_STREQ("12345", store_ptr);
 }
 
+class MyAllocBlockCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_old_cache_size = mem_root_block_cache_size;
+    mem_root_block_cache_size = 256 * 1024;
+    // Start from an empty cache.
+    free_root_block_cache();
+    init_root_block_cache();
+  }
+  void TearDown() override {
+    mem_root_block_cache_size = m_old_cache_size;
+    free_root_block_cache();
+    init_root_block_cache();
+  }
+  ulong m_old_cache_size;
+};
+
+TEST_F(MyAllocBlockCacheTest, FreedBlocksAreReused) {
+  MEM_ROOT alloc1(PSI_NOT_INSTRUMENTED, 512);
+  void *ptr = alloc1.Alloc(16);
+  alloc1.Clear();
+
+  if (root_block_cache_bytes() == 0) {
+    // Running under Valgrind/ASAN, where blocks are never reused.
+    return;
+  }
+  EXPECT_EQ(512U, root_block_cache_bytes());
+
+  MEM_ROOT alloc2(PSI_NOT_INSTRUMENTED, 512);
+  EXPECT_EQ(ptr, alloc2.Alloc(16));
+  EXPECT_EQ(0U, root_block_cache_bytes());
+}
+
+TEST_F(MyAllocBlockCacheTest, CacheIsBounded) {
+  mem_root_block_cache_size = 1024;
+  {
+    MEM_ROOT alloc1(PSI_NOT_INSTRUMENTED, 512);
+    MEM_ROOT alloc2(PSI_NOT_INSTRUMENTED, 512);
+    MEM_ROOT alloc3(PSI_NOT_INSTRUMENTED, 512);
+    (void)alloc1.Alloc(16);
+    (void)alloc2.Alloc(16);
+    (void)alloc3.Alloc(16);
+  }
+  EXPECT_LE(root_block_cache_bytes(), 1024U);
+
+  // Large blocks are never kept.
+  size_t cached = root_block_cache_bytes();
+  {
+    MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 128 * 1024);
+    (void)alloc.Alloc(16);
+  }
+  EXPECT_EQ(cached, root_block_cache_bytes());
+
+  // A size of 0 disables the cache.
+  free_root_block_cache();
+  init_root_block_cache();
+  mem_root_block_cache_size = 0;
+  {
+    MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
+    (void)alloc.Alloc(16);
+  }
+  EXPECT_EQ(0U, root_block_cache_bytes());
+}
+
+TEST_F(MyAllocBlockCacheTest, ThreadEndEmptiesCache) {
+  {
+    MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
+    (void)alloc.Alloc(16);
+  }
+
+  // What my_thread_end() does: free the cache and stop filling it.
+  free_root_block_cache();
+  EXPECT_EQ(0U, root_block_cache_bytes());
+  {
+    MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
+    (void)alloc.Alloc(16);
+  }
+  EXPECT_EQ(0U, root_block_cache_bytes());
+}
+
+TEST_F(MyAllocBlockCacheTest, FlushKeepsCaching) {
+  {
+    MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
+    (void)alloc.Alloc(16);
+  }
+  if (root_block_cache_bytes() == 0) {
+    // Running under Valgrind/ASAN, where blocks are never reused.
+    return;
+  }
+
+  // What an idle connection thread does: free the cache, keep filling it.
+  flush_root_block_cache();
+  EXPECT_EQ(0U, root_block_cache_bytes());
+  {
+    MEM_ROOT alloc(PSI_NOT_INSTRUMENTED, 512);
+    (void)alloc.Alloc(16);
+  }
+  EXPECT_EQ(512U, root_block_cache_bytes());
+}
+
 }  // namespace my_alloc_unittest
@@ -2265,6 +2265,39 @@ TEST(BitfiddlingTest, FastOutOfRange16) {
   }
 }
 
+/*
+  The 64-bit variant of the trick, as used by the eight-byte fast path.
+  Exhaustive testing is out of the question, so test all values of every
+  pair of bytes, with the other bytes in range.
+*/
+TEST(BitfiddlingTest, FastOutOfRange64) {
+  auto out_of_range = [](int c) { return c < 0x20 || c > 0x7e; };
+  unsigned char bytes[8];
+  for (int i = 0; i < 8; ++i) {
+    for (int j = i + 1; j < 8; ++j) {
+      for (int a = 0; a < 256; ++a) {
+        for (int b = 0; b < 256; ++b) {
+          memset(bytes, 'a', sizeof(bytes));
+          bytes[i] = a;
+          bytes[j] = b;
+          bool any_out_of_range_slow = out_of_range(a) || out_of_range(b);
+
+          uint64 eight_bytes;
+          memcpy(&eight_bytes, bytes, sizeof(eight_bytes));
+          bool any_out_of_range_fast =
+              (((eight_bytes + 0x0101010101010101ULL) &
+                0x8080808080808080ULL) ||
+               ((eight_bytes - 0x2020202020202020ULL) &
+                0x8080808080808080ULL));
+
+          ASSERT_EQ(any_out_of_range_slow, any_out_of_range_fast)
+              << i << " " << j << " " << a << " " << b;
+        }
+      }
+    }
+  }
+}
+
 uint64 hash(CHARSET_INFO *cs, const char *str) {
   uint64 nr1 = 1, nr2 = 4;
   cs->coll->hash_sort(cs, pointer_cast<const uchar *>(str), strlen(str), &nr1,
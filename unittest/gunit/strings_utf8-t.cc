@@ -797,4 +797,35 @@ TEST(WellFormedCopy, WellFormed) {
       &my_charset_utf8mb4_0900_ai_ci, &my_charset_utf8mb4_0900_ai_ci,
       u8"でもっとも普及しているオープンソースデータベースソフトウ"));
 }
+
+TEST_F(StringsUTF8Test, MyConvertMixedAsciiRuns) {
+  // ASCII runs of every length around the eight-byte fast path, separated
+  // by characters that need conversion or have no latin1 mapping.
+  std::string utf8_src;
+  std::string latin1_expected;
+  for (size_t run = 0; run < 20; ++run) {
+    utf8_src.append(run, 'a' + run);
+    latin1_expected.append(run, 'a' + run);
+    if (run % 2 == 0) {
+      utf8_src.append(u8"\u00e6");  // LATIN SMALL LETTER AE
+      latin1_expected.push_back('\xe6');
+    } else {
+      utf8_src.append(u8"\u4e00");  // CJK IDEOGRAPH, not in latin1
+      latin1_expected.push_back('?');
+    }
+  }
+
+  char buf[1024];
+  uint errors;
+  size_t len = my_convert(buf, sizeof(buf), &my_charset_latin1,
+                          utf8_src.data(), utf8_src.size(),
+                          &my_charset_utf8mb4_0900_ai_ci, &errors);
+  EXPECT_EQ(10U, errors);
+  EXPECT_EQ(latin1_expected, std::string(buf, len));
+
+  // The output buffer ends in the middle of an ASCII run.
+  len = my_convert(buf, 30, &my_charset_latin1, utf8_src.data(),
+                   utf8_src.size(), &my_charset_utf8mb4_0900_ai_ci, &errors);
+  EXPECT_EQ(latin1_expected.substr(0, 30), std::string(buf, len));
+}
 }  // namespace strings_utf8_unittest
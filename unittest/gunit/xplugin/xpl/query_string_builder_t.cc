@@ -290,6 +290,16 @@ INSTANTIATE_TEST_SUITE_P(
         Query_and_expected_values("SELECT ? FROM", "",
                                   Assign_list("First")("Second"))));
 
+TEST_F(Query_string_builder_testsuite, quote_string_escapesAsciiAndMultibyte) {
+  const std::string value("a'b\"c\\d\ne\rf\032g" + std::string(1, '\0') +
+                          "h\xc3\xa6'i\xe4\xb8\x80\"j");
+  query.quote_string(value);
+
+  ASSERT_STREQ(
+      "'a\\'b\\\"c\\\\d\\ne\\rf\\Zg\\0h\xc3\xa6\\'i\xe4\xb8\x80\\\"j'",
+      query.get().c_str());
+}
+
 }  // namespace test
 
 }  // namespace xpl
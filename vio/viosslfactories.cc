@@ -47,6 +47,13 @@
 
 #define TLS_VERSION_OPTION_SIZE 256
 
+/*
+  Number of TLS sessions the acceptor keeps for session ID resumption.
+  Sized so that a burst of reconnecting clients can resume instead of
+  each doing a full handshake; expired sessions are flushed by OpenSSL.
+*/
+#define VIO_SSL_SESSION_CACHE_SIZE 4096
+
 /*
   1. Cipher preference order: P1 > A1 > A2 > D1
   2. Blocked ciphers are not allowed
@@ -834,7 +841,7 @@ struct st_VioSSLFd *new_VioSSLAcceptorFd(
   /* Init the the VioSSLFd as a "acceptor" ie. the server side */
 
   /* Set max number of cached sessions, returns the previous size */
-  SSL_CTX_sess_set_cache_size(ssl_fd->ssl_context, 128);
+  SSL_CTX_sess_set_cache_size(ssl_fd->ssl_context, VIO_SSL_SESSION_CACHE_SIZE);
 
   SSL_CTX_set_verify(ssl_fd->ssl_context, verify, nullptr);
 